@@ -2,7 +2,7 @@
 
 QT       += core gui widgets
 
-CONFIG   += c++17 console
+CONFIG   += c++17 console thread
 CONFIG   -= app_bundle
 
 TEMPLATE = app
@@ -10,35 +10,75 @@ TEMPLATE = app
 # Source files
 SOURCES += \
     src/main.cpp \
-    src/game.cpp \
+    src/AssetManager.cpp \
     src/Difficulty.cpp \
+    src/FrameStats.cpp \
+    src/GameClock.cpp \
     src/GameController.cpp \
+    src/GameRules.cpp \
+    src/GameSession.cpp \
     src/Help.cpp \
     src/Instructions.cpp \
-    src/LetterGuesser.cpp \
+    src/LetterBoard.cpp \
+    src/LetterRecommender.cpp \
     src/MainController.cpp \
-    src/PhraseHandler.cpp \
+    src/PhraseBoard.cpp \
+    src/PhraseBoardWidget.cpp \
+    src/PhraseHistory.cpp \
+    src/PhraseIndex.cpp \
     src/PhraseLibrary.cpp \
+    src/PhraseLibraryWatcher.cpp \
+    src/PhrasePack.cpp \
+    src/PhraseScheduler.cpp \
+    src/PhraseScorer.cpp \
+    src/PhraseSelector.cpp \
+    src/PhraseSolver.cpp \
+    src/PromptOverlay.cpp \
+    src/Random.cpp \
+    src/SessionLog.cpp \
+    src/ShardedPhraseSource.cpp \
+    src/StringArena.cpp \
     src/Wheel.cpp \
-    src/mainwindow.cpp \
-    src/timer.cpp
+    src/WheelDefinition.cpp \
+    src/mainwindow.cpp
 
 # Header files
 HEADERS += \
-    src/game.h \
+    src/AssetManager.h \
     src/Difficulty.h \
+    src/FrameStats.h \
+    src/GameClock.h \
     src/GameController.h \
+    src/GameRules.h \
+    src/GameSession.h \
     src/Help.h \
     src/Instructions.h \
     src/Instructionss.h \
-    src/LetterGuesser.h \
+    src/LetterBoard.h \
+    src/LetterRecommender.h \
     src/MainController.h \
-    src/PhraseHandler.h \
+    src/Parallel.h \
+    src/PhraseBoard.h \
+    src/PhraseBoardWidget.h \
+    src/PhraseHistory.h \
+    src/PhraseIndex.h \
     src/PhraseLibrary.h \
+    src/PhraseLibraryWatcher.h \
+    src/PhrasePack.h \
+    src/PhrasePackFormat.h \
+    src/PhraseScheduler.h \
+    src/PhraseScorer.h \
+    src/PhraseSelector.h \
+    src/PhraseSolver.h \
+    src/PhraseView.h \
+    src/PromptOverlay.h \
+    src/Random.h \
+    src/SessionLog.h \
+    src/ShardedPhraseSource.h \
+    src/StringArena.h \
     src/Wheel.h \
-    src/mainwindow.h \
-    src/timer.h \
-    src/PlayerGems.h
+    src/WheelDefinition.h \
+    src/mainwindow.h
 
 # UI files
 FORMS += \
@@ -0,0 +1,108 @@
+// This file decodes the game's images on worker threads and caches them as pixmaps
+
+#include "AssetManager.h"
+#include "GameRules.h"
+
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QImage>
+#include <QImageReader>
+#include <QThreadPool>
+
+#include <atomic>
+#include <future>
+#include <memory>
+
+namespace {
+
+struct Asset {
+    QString path;
+    QSize size;  // display size, invalid = keep the full resolution
+};
+
+struct Entry {
+    std::shared_future<QImage> image;  // pending decode, dropped once it became a pixmap
+    QPixmap pixmap;
+    bool ready = false;
+};
+
+// Every screen is 750x550. The wheel images stay at full size, the Wheel scales them itself
+// to the size of its view.
+QList<Asset> knownAssets() {
+    QList<Asset> assets = {
+        { ":/images/images/SPIN_SOLVE.png", QSize(750, 550) },
+        { ":/images/images/Instructions.png", QSize(750, 550) },
+        { ":/images/images/background.png", QSize(750, 550) },
+        { ":/images/images/arrow.png", QSize() },
+    };
+
+    const QString wheelImage = GameRules::active().wheel.image();
+    if (!wheelImage.isEmpty())
+        assets.append({ wheelImage, QSize() });
+    return assets;
+}
+
+QHash<QString, Entry> &entries() {
+    static QHash<QString, Entry> cache;
+    return cache;
+}
+
+// Decoding, scaling and the conversion to the format the screen is painted in all happen
+// here, so turning the result into a pixmap on the GUI thread is only a copy
+QImage decode(const QString &path, const QSize &size, qreal ratio) {
+    QImageReader reader(path);
+    QImage image = reader.read();
+    if (image.isNull()) {
+        qWarning() << "Could not load image" << path << reader.errorString();
+        return image;
+    }
+
+    if (size.isValid()) {
+        image = image.scaled(size * ratio, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+        image.setDevicePixelRatio(ratio);
+    }
+    return image.convertToFormat(image.hasAlphaChannel() ? QImage::Format_ARGB32_Premultiplied
+                                                         : QImage::Format_RGB32);
+}
+
+} // namespace
+
+void AssetManager::preload(qreal devicePixelRatio) {
+    static bool started = false;
+    if (started)
+        return;
+    started = true;
+
+    const QList<Asset> assets = knownAssets();
+    auto remaining = std::make_shared<std::atomic<int>>(static_cast<int>(assets.size()));
+    auto total = std::make_shared<QElapsedTimer>();
+    total->start();
+
+    for (const Asset &asset : assets) {
+        auto promise = std::make_shared<std::promise<QImage>>();
+        entries()[asset.path].image = promise->get_future().share();
+
+        QThreadPool::globalInstance()->start([asset, devicePixelRatio, promise, remaining, total]() {
+            QElapsedTimer timer;
+            timer.start();
+            QImage image = decode(asset.path, asset.size, devicePixelRatio);
+            qInfo() << "Decoded" << asset.path << image.size() << "in" << timer.elapsed() << "ms";
+            promise->set_value(std::move(image));
+
+            if (--*remaining == 0)
+                qInfo() << "Decoded all images in" << total->elapsed() << "ms";
+        });
+    }
+}
+
+QPixmap AssetManager::pixmap(const QString &path) {
+    Entry &entry = entries()[path];
+    if (!entry.ready) {
+        const QImage image = entry.image.valid() ? entry.image.get() : decode(path, QSize(), 1.0);
+        entry.pixmap = QPixmap::fromImage(image);
+        entry.image = std::shared_future<QImage>();
+        entry.ready = true;
+    }
+    return entry.pixmap;
+}
@@ -0,0 +1,22 @@
+#ifndef ASSETMANAGER_H
+#define ASSETMANAGER_H
+
+#include <QPixmap>
+#include <QString>
+
+// Decodes the game's images once and hands out shared pixmaps of them.
+// preload() decodes every known image in parallel on worker threads and scales it to the size
+// it is shown at, so opening a screen or repainting only blits. Pixmaps are implicitly shared:
+// all widgets showing an image use the same pixel data.
+class AssetManager {
+public:
+    // Starts decoding the known images in the background. Call once from main, after the
+    // application object exists.
+    static void preload(qreal devicePixelRatio);
+
+    // The image at its display size, waiting for its decode if that is still running. Images
+    // that were not preloaded are decoded here at full size. GUI thread only.
+    static QPixmap pixmap(const QString &path);
+};
+
+#endif // ASSETMANAGER_H
@@ -0,0 +1,48 @@
+// This file collects frame times into a histogram for the rendering diagnostics
+
+#include "FrameStats.h"
+
+#include <algorithm>
+
+void FrameStats::record(std::int64_t nanoseconds) {
+    if (nanoseconds < 0)
+        nanoseconds = 0;
+
+    const std::int64_t bucket = std::min<std::int64_t>(nanoseconds / 1000000, bucketCount - 1);
+    histogram[static_cast<std::size_t>(bucket)]++;
+    frames++;
+    totalNanos += nanoseconds;
+    maxNanos = std::max(maxNanos, nanoseconds);
+}
+
+void FrameStats::clear() {
+    histogram.fill(0);
+    frames = 0;
+    totalNanos = 0;
+    maxNanos = 0;
+}
+
+double FrameStats::averageMillis() const {
+    return frames ? totalNanos / 1e6 / static_cast<double>(frames) : 0.0;
+}
+
+int FrameStats::percentileMillis(double fraction) const {
+    if (frames == 0)
+        return 0;
+
+    const double wanted = fraction * static_cast<double>(frames);
+    std::uint64_t seen = 0;
+    for (int i = 0; i < bucketCount; i++) {
+        seen += histogram[i];
+        if (static_cast<double>(seen) >= wanted)
+            return i + 1;
+    }
+    return bucketCount;
+}
+
+std::uint64_t FrameStats::framesFrom(int millis) const {
+    std::uint64_t total = 0;
+    for (int i = std::max(0, std::min(millis, bucketCount - 1)); i < bucketCount; i++)
+        total += histogram[i];
+    return total;
+}
@@ -0,0 +1,35 @@
+#ifndef FRAMESTATS_H
+#define FRAMESTATS_H
+
+#include <array>
+#include <cstdint>
+
+// Histogram of frame times with 1 ms buckets. Recording a frame is a single increment, so it
+// can run inside a paint event; percentiles are read from the buckets afterwards.
+class FrameStats {
+public:
+    static constexpr int bucketCount = 64;  // the last bucket holds every frame of 63 ms or more
+
+    void record(std::int64_t nanoseconds);
+    void clear();
+
+    std::uint64_t count() const { return frames; }
+    double averageMillis() const;
+    double maxMillis() const { return maxNanos / 1e6; }
+
+    // Upper edge of the bucket holding the given fraction of the frames (0.95 = 95th percentile)
+    int percentileMillis(double fraction) const;
+
+    // Frames that took at least the given number of whole milliseconds, e.g. 17 for 60 fps
+    std::uint64_t framesFrom(int millis) const;
+
+    const std::array<std::uint32_t, bucketCount> &buckets() const { return histogram; }
+
+private:
+    std::array<std::uint32_t, bucketCount> histogram{};
+    std::uint64_t frames = 0;
+    std::int64_t totalNanos = 0;
+    std::int64_t maxNanos = 0;
+};
+
+#endif // FRAMESTATS_H
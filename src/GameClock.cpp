@@ -0,0 +1,35 @@
+// This file measures the game time of a round on the monotonic clock
+
+#include "GameClock.h"
+
+void GameClock::reset() {
+    bankedNanos = 0;
+    takenNanos = 0;
+    running = false;
+}
+
+void GameClock::resume(Clock::time_point now) {
+    if (running)
+        return;
+    resumedAt = now;
+    running = true;
+}
+
+void GameClock::pause(Clock::time_point now) {
+    if (!running)
+        return;
+    bankedNanos = elapsedNanos(now);
+    running = false;
+}
+
+std::int64_t GameClock::elapsedNanos(Clock::time_point now) const {
+    if (!running)
+        return bankedNanos;
+    return bankedNanos + std::chrono::duration_cast<std::chrono::nanoseconds>(now - resumedAt).count();
+}
+
+std::int64_t GameClock::takeElapsedMillis(Clock::time_point now) {
+    const std::int64_t millis = (elapsedNanos(now) - takenNanos) / 1000000;
+    takenNanos += millis * 1000000;
+    return millis;
+}
@@ -0,0 +1,37 @@
+#ifndef GAMECLOCK_H
+#define GAMECLOCK_H
+
+#include <chrono>
+#include <cstdint>
+
+// Game time that can be paused. It reads std::chrono::steady_clock, which never jumps with the
+// wall clock, and measures from fixed points instead of adding up timer intervals, so late or
+// skipped timer events never make it drift; a timer only decides when to look at it.
+// Time is handed out in whole milliseconds and the remainder carries over to the next take,
+// so no time is lost across pauses either.
+class GameClock {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    bool isRunning() const { return running; }
+
+    // Stops the clock and forgets the time it has run
+    void reset();
+
+    void resume(Clock::time_point now = Clock::now());
+    void pause(Clock::time_point now = Clock::now());
+
+    // Time the clock has run since the last reset, pauses excluded
+    std::int64_t elapsedNanos(Clock::time_point now = Clock::now()) const;
+
+    // Whole milliseconds run since the last take, e.g. for GameSession::tick()
+    std::int64_t takeElapsedMillis(Clock::time_point now = Clock::now());
+
+private:
+    Clock::time_point resumedAt;
+    std::int64_t bankedNanos = 0;  // run before the last resume
+    std::int64_t takenNanos = 0;   // already handed out by takeElapsedMillis
+    bool running = false;
+};
+
+#endif // GAMECLOCK_H
@@ -1,34 +1,71 @@
-// This file implements the main gameplay logic and UI for Spin & Solve
-// It handles the wheel, letter guessing, timers, hints, gems, and end-of-game scenarios.
+// This file implements the game screen of Spin & Solve
+// It shows the wheel, phrase, timer, hints and gems of a GameSession and turns the player's
+// input into session commands.
 
 #include "GameController.h"
+#include "AssetManager.h"
 #include "MainController.h"
-#include "PhraseLibrary.h"
-#include "PlayerGems.h"
 #include "Help.h"
-#include "PhraseHandler.h"
 
 #include <QVBoxLayout>
 #include <QHBoxLayout>
-#include <QMessageBox>
+#include <QDateTime>
 #include <QDebug>
+#include <QDir>
+#include <QFile>
 #include <QCloseEvent>
 #include <QPainter>
-#include <QInputDialog>
+#include <QKeyEvent>
+#include <QStandardPaths>
 #include <QTimer>
 
+// Phrase data is served as UTF-8 views, convert them for display
+static QString toQString(std::string_view text) {
+    return QString::fromUtf8(text.data(), static_cast<int>(text.size()));
+}
+
+static QString toQString(const std::string &text) {
+    return toQString(std::string_view(text));
+}
+
 GameController::GameController(int diff, QWidget *parent)
-    : QWidget(parent), difficulty(diff), playerGems(0, this) {
+    : QWidget(parent), difficulty(diff) {
 
     setFixedSize(750, 550);
+    background = AssetManager::pixmap(":/images/images/background.png");
 
+    openSessionLog();
     setUpUI();
+
+    // From here on every change of the session shows up through its events
+    session.setListener([this](const GameSession::Event &event) { handleSessionEvent(event); });
+}
+
+// Sessions are logged to <app data>/sessions/<start time>-<seed>.sslog; a game without a
+// log still plays
+void GameController::openSessionLog() {
+    const QDir directory(QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + "/sessions");
+    if (!directory.mkpath(".")) {
+        qWarning() << "Cannot create the session log directory" << directory.path();
+        return;
+    }
+
+    const QString name = QDateTime::currentDateTime().toString("yyyyMMdd-HHmmss")
+                         + QString("-%1.sslog").arg(session.seed(), 16, 16, QChar('0'));
+    const QString path = directory.filePath(name);
+    sessionLog = std::make_unique<SessionLogWriter>(QFile::encodeName(path).toStdString(), rules, session.seed());
+    if (!sessionLog->isOpen()) {
+        qWarning() << "Cannot write the session log" << path;
+        sessionLog.reset();
+        return;
+    }
+    session.setLog(sessionLog.get());
 }
 
 // Wheel setup
 void GameController::setUpWheel() {
     if (!wheel) {
-        wheel = new Wheel(this);
+        wheel = new Wheel(rules.wheel, random.split(), this);
         wheel->setFixedSize(280, 280);
         wheel->setStyleSheet(
             "border: 5px solid #FFE3F8;"
@@ -36,246 +73,271 @@ void GameController::setUpWheel() {
             "background-color: #FFE3F8;"
             );
 
-        // Connect wheel landing to reward processing
+        // The session decided the segment when the spin started, the consonant is asked for
+        // once the wheel shows it
         connect(wheel, &Wheel::landedSegment, this, [=](int index){
-            QStringList segments = { "2 gems","-5 seconds","3 gems","Free Hint",
-                                    "1 gem","-10 seconds","2 gems","4 gems" };
-            QString landedSegment = segments[index];
+            const WheelSegment &landedSegment = rules.wheel.segment(index);
 
-            wheelResultLabel->setText("Wheel landed on: " + landedSegment);
+            wheelResultLabel->setText("Wheel landed on: " + QString::fromStdString(landedSegment.label));
 
-            startLetterGuessing(landedSegment);
+            startLetterGuessing();
         });
     }
 }
 
-// Handles letter guessing
-void GameController::startLetterGuessing(const QString &landedSegment) {
-
-    if (!gameActive || remainingTime <= 0 || letterDialogOpen) return;
-
-    letterDialogOpen = true;
+// Handles letter guessing: the letter board takes consonants until the player picks one, with
+// the keyboard or on screen
+void GameController::startLetterGuessing() {
 
-    auto askForLetter = std::make_shared<std::function<void()>>();
-
-    *askForLetter = [this, landedSegment, askForLetter]() {
-        if (!gameActive || remainingTime <= 0) {
-            letterDialogOpen = false;
-            return;
-        }
+    if (flow != Flow::Playing || session.phase() != GameSession::Phase::Consonant) return;
 
-        QInputDialog *dialog = new QInputDialog(this);
-        dialog->setWindowTitle("Guess a Letter");
-        dialog->setLabelText("Enter a letter (non-vowel only):");
-        dialog->setTextValue("");
-        dialog->setInputMode(QInputDialog::TextInput);
-        dialog->setModal(true);
-
-        activeDialogs.append(dialog);
-
-        connect(dialog, &QInputDialog::textValueSelected, this, [=](const QString &guess) {
-            dialog->deleteLater();
-            activeDialogs.removeOne(dialog);
-
-            letterDialogOpen = false;
-
-            QChar letter = guess.isEmpty() ? QChar() : guess[0].toUpper();
-
-            // Validation in order to guess a single constant, any other guess is invalid and the user will be prompted to guess again
-            if (guess.length() != 1) {
-                showWarningAndRetry("Invalid Input", "Please enter only one letter.", *askForLetter, true);
-                return;
-            }
-
-            if (!letter.isLetter()) {
-                showWarningAndRetry("Invalid Input", "Enter a single letter (A-Z).", *askForLetter, true);
-                return;
-            }
-
-            if (QString("AEIOU").contains(letter)) {
-                showWarningAndRetry("Invalid Letter", "Vowels are not allowed!", *askForLetter, true);
-                return;
-            }
-
-            // if the user attempts to guess a letter previously guessed, they will be prompted to guess another letter
-            if (guessedLetters.contains(letter)) {
-                showWarningAndRetry("Already Guessed", "You already guessed that letter!", *askForLetter, true);
-                return;
-            }
-
-            guessedLetters.insert(letter);
-
-            // Update guessed letters in the text box on the game screen
-            QString lettersText = "Guessed Letters: ";
-            for (auto l : guessedLetters)
-                lettersText += QString(l) + " ";
-            guessedLettersBox->setText(lettersText);
-
-
-            if (phraseHandler->guessLetter(letter)) {
-                updateDisplayedPhrase();
-                handleWheelReward(landedSegment);
-
-                if (phraseHandler->isComplete()) {
-                    endGame("You Win!", "You guessed the full phrase!");
-                }
-            } else {
-                handleIncorrectGuess(landedSegment);
-            }
-            letterDialogOpen = false;
-        });
-
-        dialog->open();
-    };
-
-    (*askForLetter)();
+    letterBoard->setMode(LetterBoard::Consonants);
+    const WheelSegment &landedSegment = rules.wheel.segment(session.pendingSegment());
+    wheelResultLabel->setText("Wheel landed on: " + QString::fromStdString(landedSegment.label)
+                              + " - pick a consonant");
 }
 
-// Helper functions
-void GameController::showWarningAndRetry(const QString &title, const QString &text, std::function<void()> retry, bool retryDialog = false) {
-    QMessageBox *msg = new QMessageBox(this);
-    msg->setIcon(QMessageBox::Warning);
-    msg->setWindowTitle(title);
-    msg->setText(text);
-    activeDialogs.append(msg);
+// A letter from the keyboard or the letter board. The guess runs at once; a letter that cannot
+// be picked now is explained on the screen and the board keeps waiting.
+void GameController::chooseLetter(char letter) {
+    const LetterBoard::Mode mode = letterBoard->mode();
+    if (mode == LetterBoard::Locked || !catchUpClock())
+        return;
 
-    connect(msg, &QDialog::finished, this, [=]() {
-        activeDialogs.removeOne(msg);
-        if (retryDialog && retry) {
-            QTimer::singleShot(0, this, retry);  // only retry when desired
+    const QString name(QChar::fromLatin1(letter).toUpper());
+    const GameSession::Result result = mode == LetterBoard::Consonants ? session.guessConsonant(letter)
+                                                                       : session.buyVowel(letter);
+    switch (result) {
+    case GameSession::Result::Ok:
+        // The session events update the screen
+        if (letterBoard->mode() == mode)
+            letterBoard->setMode(LetterBoard::Locked);
+        break;
+    case GameSession::Result::NotConsonant:
+        wheelResultLabel->setText(name + " is a vowel - pick a consonant");
+        break;
+    case GameSession::Result::NotVowel:
+        wheelResultLabel->setText(name + " is not a vowel - pick a vowel");
+        break;
+    case GameSession::Result::AlreadyGuessed:
+        wheelResultLabel->setText("You already guessed " + name + "!");
+        break;
+    case GameSession::Result::NotEnoughGems:
+        letterBoard->setMode(LetterBoard::Locked);
+        wheelResultLabel->setText(QString("Need %1 gems!").arg(rules.vowelCost));
+        break;
+    case GameSession::Result::NotNow:
+        // The board fell out of step with the session, e.g. a wrong solve forfeited the spin
+        if (session.phase() == GameSession::Phase::Consonant) {
+            letterBoard->setMode(LetterBoard::Consonants);
+            wheelResultLabel->setText("Pick a consonant before buying a vowel!");
+        } else {
+            letterBoard->setMode(LetterBoard::Locked);
+            wheelResultLabel->setText("Spin the wheel first!");
         }
-    });
-
-    msg->open();
+        break;
+    default:
+        break;
+    }
 }
 
-void GameController::handleWheelReward(const QString &landedSegment) {
-    if (landedSegment.contains("gem")) {
-        int gemAmount = landedSegment.split(" ")[0].toInt();
-        playerGems.addGems(gemAmount);
-
-    } else if (landedSegment == "Free Hint") {
-        freeHintsCount++;
-        freeHintsLabel->setText("Free Hints: " + QString::number(freeHintsCount));
+// Letters typed anywhere on the game screen are guesses; Escape puts a vowel back
+void GameController::keyPressEvent(QKeyEvent *event) {
+    const QString text = event->text();
+    if (flow == Flow::Playing && text.length() == 1 && text[0].toLatin1() != 0
+        && !(event->modifiers() & (Qt::ControlModifier | Qt::AltModifier | Qt::MetaModifier))) {
+        const char letter = text[0].toUpper().toLatin1();
+        if (letter >= 'A' && letter <= 'Z') {
+            chooseLetter(letter);
+            return;
+        }
     }
+    if (event->key() == Qt::Key_Escape && letterBoard->mode() == LetterBoard::Vowels) {
+        letterBoard->setMode(LetterBoard::Locked);
+        wheelResultLabel->clear();
+        return;
+    }
+    QWidget::keyPressEvent(event);
 }
 
-void GameController::handleIncorrectGuess(const QString &landedSegment) {
+// The hint stays up, with the clock stopped, until the player has read it
+void GameController::showHint(const QString &text) {
+    setFlow(Flow::Paused);
+    prompt->ask("Hint", text, "OK", QString(), [this](bool, const QString &) {
+        resumePlay();
+    });
+}
 
-    if (landedSegment == "-5 seconds") {
-        remainingTime -= 5;
-    } else if (landedSegment == "-10 seconds") {
-        remainingTime -= 10;
+// Session events arrive while a command is still running. The end of a round switches the flow
+// at once, which stops the clock and every command; the end-of-game prompt, which can start a
+// new round, is deferred until the command has returned.
+void GameController::handleSessionEvent(const GameSession::Event &event) {
+    switch (event.type) {
+    case GameSession::Event::LetterRevealed:
+        updateDisplayedPhrase();
+        updateGuessedLetters();
+        break;
+    case GameSession::Event::LetterMissed:
+        updateGuessedLetters();
+        // Always show that the letter is not in the phrase
+        wheelResultLabel->setText(QString("There is no %1 in the phrase").arg(QChar::fromLatin1(event.letter)));
+        break;
+    case GameSession::Event::GemsChanged:
+        gemsLabel->setText("💎 Gems: " + QString::number(event.value));
+        break;
+    case GameSession::Event::FreeHintsChanged:
+        freeHintsLabel->setText("Free Hints: " + QString::number(event.value));
+        break;
+    case GameSession::Event::HintRevealed:
+        showHint(toQString(session.hint(static_cast<int>(event.value))));
+        break;
+    case GameSession::Event::TimeChanged:
+        updateTimerLabel();
+        if (flow == Flow::Playing)
+            scheduleClock();  // a penalty brings the next second closer
+        break;
+    case GameSession::Event::SolveFailed:
+        // Incorrect guess
+        wheelResultLabel->setText("Sorry, that was not correct. Keep playing!");
+        break;
+    case GameSession::Event::Won: {
+        updateDisplayedPhrase();
+        setFlow(Flow::RoundOver);
+        const QString message = (event.value != 0 ? "You guessed the full phrase!"
+                                                  : "Congratulations! You guessed the full phrase correctly!")
+                                + QString("\n\nTime left: %1 s").arg(session.remainingMillis() / 1000.0, 0, 'f', 3);
+        QTimer::singleShot(0, this, [this, message]() { endGame("You Win!", message); });
+        break;
     }
-
-    // Always show that the letter is not in the phrase
-    showWarningAndRetry("Incorrect", "The letter is not in the phrase.", nullptr, false);
-
-    if (remainingTime < 0) remainingTime = 0;
-
-    updateTimerLabel();
-
-    if (remainingTime == 0) {
-        if (wheel) wheel->stopSpin();
-        endGame("Time's Up!", "You ran out of time! Do you want to start a new game?");
+    case GameSession::Event::Lost:
+        updateDisplayedPhrase();
+        setFlow(Flow::RoundOver);
+        QTimer::singleShot(0, this, &GameController::timeUp);
+        break;
+    case GameSession::Event::SpinLanded:
+        break;
     }
 }
 
+void GameController::updateGuessedLetters() {
+    const PhraseBoard &board = session.board();
+    letterBoard->setGuessed(board.guessedMask(), board.letterMask());
+}
+
 // Timer functions
+// Only touches the label when the shown second or its colour changes. Seconds are rounded up,
+// so 0:00 is only shown once the time is over.
 void GameController::updateTimerLabel() {
+    const int remainingTime = static_cast<int>((session.remainingMillis() + 999) / 1000);
+    if (remainingTime == displayedSeconds)
+        return;
+    displayedSeconds = remainingTime;
+
     int minutes = remainingTime / 60;
     int seconds = remainingTime % 60;
     timerLabel->setText(QString("Time: %1:%2")
                             .arg(minutes)
                             .arg(seconds, 2, 10, QChar('0')));
+
+    const bool runningOut = session.remainingMillis() < 12000;
+    if (runningOut != timeRunningOut) {
+        timeRunningOut = runningOut;
+        timerLabel->setStyleSheet(runningOut ? "font-size: 18px; font-weight: bold; color: red;"
+                                             : "font-size: 18px; font-weight: bold; color: #8F0774;");
+    }
 }
 
 void GameController::initializePhrase() {
-    PhraseLibrary library;
-
-    // Pick a random phrase
-    Phrase selectedPhrase = library.getRandomPhrase(difficulty == 0 ? "easy" : "hard");
+    // Pick a random phrase from the shared library
+    PhraseView selectedPhrase = phraseSelector.getRandomPhrase(difficulty);
 
-    QString phrase = QString::fromStdString(selectedPhrase.text);
-    QString category = QString::fromStdString(selectedPhrase.category);
+    QString category = toQString(selectedPhrase.category);
 
     if (categoryLabel) {
         categoryLabel->setText("Category: " + category);
     }
 
-    if (phraseHandler) {
-        delete phraseHandler;
-        phraseHandler = nullptr;
-    }
-
-    phraseHandler = new PhraseHandler(phrase);
-    displayedPhrase = phraseHandler->getDisplayedPhrase();
-
-    // Reset hint tracking for this new phrase
-    currentHintIndex = 0;
-
-    // Load hints directly from the selectedPhrase object
-    hintsForCurrentPhrase.clear();
-    for (const std::string &hint : selectedPhrase.hints) {
-        hintsForCurrentPhrase.append(QString::fromStdString(hint));
-    }
+    // The board plays the Latin-1 text, one character per cell
+    GameSession::Phrase phrase;
+    const QByteArray latin1 = toQString(selectedPhrase.text).toLatin1();
+    phrase.text.assign(latin1.constData(), static_cast<std::size_t>(latin1.size()));
+    phrase.id = selectedPhrase.id;
+    phrase.categoryId = selectedPhrase.categoryId;
+    for (int i = 0; i < selectedPhrase.hintCount; i++)
+        phrase.hints.emplace_back(selectedPhrase.hints[i]);
+
+    session.start(difficulty, std::move(phrase));
+
+    // The board lays itself out once for the new phrase, later updates only reveal cells
+    session.takeDirtyRange();
+    if (phraseBoard)
+        phraseBoard->setBoard(session.board());
 }
 
 
 void GameController::updateDisplayedPhrase()
 {
-    if (!phraseLabel || !phraseHandler) return;
-
-    displayedPhrase = phraseHandler->getDisplayedPhrase();
+    if (!phraseBoard) return;
 
-    // Display using monospace font and avoid HTML collapsing spaces
-    phraseLabel->setText(displayedPhrase);
-    phraseLabel->setStyleSheet("font-family: monospace; font-size: 30px; font-weight: bold;");
+    // Only the tiles of the cells changed since the last update are repainted
+    const PhraseBoard::DirtyRange dirty = session.takeDirtyRange();
+    if (!dirty.isEmpty())
+        phraseBoard->reveal(dirty.begin, dirty.end);
 }
 
-void GameController::updateTimer() {
-
-    if (remainingTime < 12) {
-        timerLabel->setStyleSheet(
-            "font-size: 18px; font-weight: bold; color: red;"
-            );
-    } else {
-        timerLabel->setStyleSheet(
-            "font-size: 18px; font-weight: bold; color: #8F0774;"
-            );
-    }
+// Hands the time that passed since the last call to the session, so that every command sees
+// the clock to the millisecond. Returns false if the game is not playing (any more): the
+// round may just have run out of time.
+bool GameController::catchUpClock() {
+    if (flow != Flow::Playing)
+        return false;
 
-    if (remainingTime <= 0) {
-        gameTimer->stop();
-        closeAllDialogs();
+    session.tick(clock.takeElapsedMillis());
+    return flow == Flow::Playing;
+}
 
-        // Reveal the full phrase if timer runs out
-        if (phraseHandler) {
-            phraseHandler->revealPhrase();
-            updateDisplayedPhrase();
-        }
+// Wakes up when the displayed second changes; waking up early or late costs an extra wake-up
+// or a late label, never game time
+void GameController::scheduleClock() {
+    const std::int64_t remaining = session.remainingMillis();
+    if (remaining <= 0)
+        return;
+    gameTimer->start(static_cast<int>((remaining - 1) % 1000 + 1));
+}
 
-        QMessageBox::StandardButton reply = QMessageBox::question(
-            this,
-            "Time's Up!",
-            "You ran out of time!\n\nThe phrase was:\n\n\""
-                + phraseHandler->getOriginalPhrase() +
-                "\"\n\nDo you want to start a new game?",
-            QMessageBox::Yes | QMessageBox::No
-            );
+void GameController::updateTimer() {
+    // Nothing to do for a timeout queued before the clock stopped
+    if (catchUpClock())
+        scheduleClock();
+}
 
-        if (reply == QMessageBox::Yes) {
-            startNewGame();
-        } else {
-            returnToMainMenu(false);
-        }
+// The round ran out of time, the session has already revealed the phrase
+void GameController::timeUp() {
+    endGame("Time's Up!",
+            "You ran out of time!\n\nThe phrase was:\n\n\"" + toQString(session.board().text()) + "\"");
+}
 
+// The clock runs exactly while the game is playing. Commands catch up with the clock before
+// they run, so pausing right after one charges the time up to it.
+void GameController::setFlow(Flow next) {
+    flow = next;
+    if (!gameTimer)
         return;
-    }
 
-    remainingTime--;
+    if (flow == Flow::Playing) {
+        clock.resume();
+        scheduleClock();
+    } else {
+        clock.pause();
+        gameTimer->stop();
+    }
+}
 
-    updateTimerLabel();
+// Back to playing after a prompt; a spin that landed in the meantime still needs its consonant
+void GameController::resumePlay() {
+    setFlow(Flow::Playing);
+    if (session.phase() == GameSession::Phase::Consonant && wheel && !wheel->isSpinning())
+        startLetterGuessing();
 }
 
 // Initlaize labels
@@ -286,39 +348,30 @@ void GameController::setUpLabels() {
     categoryLabel->setAlignment(Qt::AlignCenter);
     categoryLabel->setStyleSheet("font-size: 18px; color: #8F0774; font-weight: bold;");
 
-    initializePhrase();
+    // Phrase board
+    phraseBoard = new PhraseBoardWidget(this);
 
-    // Phrase label
-    phraseLabel = new QLabel(displayedPhrase, this);
-    phraseLabel->setAlignment(Qt::AlignCenter);
-    phraseLabel->setWordWrap(true);
-    phraseLabel->setStyleSheet("font-size: 30px; font-weight: bold;");
+    initializePhrase();
 
     // Gems label
-    gemsLabel = new QLabel("💎 Gems: " + QString::number(playerGems.getGems()), this);
+    gemsLabel = new QLabel("💎 Gems: " + QString::number(session.gems()), this);
     gemsLabel->setAlignment(Qt::AlignCenter);
     gemsLabel->setFixedWidth(100);
     gemsLabel->setStyleSheet("font-size: 18px; color: #8F0774; font-weight: bold;");
 
-    connect(&playerGems, &PlayerGems::gemsChanged, this, [=](int newGems){
-        gemsLabel->setText("💎 Gems: " + QString::number(newGems));
-    });
-
     // Timer label
-    int initialTime = (difficulty == 0) ? 120 : 180; // 20 or 180 seconds
-    remainingTime = initialTime;
-
     timerLabel = new QLabel("", this);
     updateTimerLabel();
     timerLabel->setAlignment(Qt::AlignCenter);
     timerLabel->setStyleSheet("font-size: 18px; color: #8F0774; font-weight: bold;");
 
     gameTimer = new QTimer(this);
+    gameTimer->setSingleShot(true);
+    gameTimer->setTimerType(Qt::PreciseTimer);
     connect(gameTimer, &QTimer::timeout, this, &GameController::updateTimer);
-    //gameTimer->start(1000); // tick every second
 
     // Free hints label
-    freeHintsLabel = new QLabel("Free Hints: " + QString::number(freeHintsCount), this);
+    freeHintsLabel = new QLabel("Free Hints: " + QString::number(session.freeHints()), this);
     freeHintsLabel->setAlignment(Qt::AlignCenter);
     freeHintsLabel->setFixedWidth(120);
     freeHintsLabel->setStyleSheet("font-size: 18px; color: #8F0774; font-weight: bold;");
@@ -332,13 +385,12 @@ void GameController::setUpLabels() {
 // Handle UI set up
 void GameController::setUpUI() {
 
-    // Guessed letters box
-    guessedLettersBox = new QLineEdit(this);
-    guessedLettersBox->setReadOnly(true);
-    guessedLettersBox->setAlignment(Qt::AlignCenter);
-    guessedLettersBox->setStyleSheet("font-size: 15px;");
-    guessedLettersBox->setFixedWidth(450);
-    guessedLettersBox->setFixedHeight(26);
+    // Letter board, guessed letters are marked on it
+    letterBoard = new LetterBoard(this);
+    connect(letterBoard, &LetterBoard::letterChosen, this, &GameController::chooseLetter);
+
+    // Typed letters reach the screen unless a text field has the focus
+    setFocusPolicy(Qt::StrongFocus);
 
     setUpLabels();
     setUpWheel();
@@ -364,7 +416,7 @@ void GameController::setUpUI() {
     wheelLayout->addWidget(wheel, 0, Qt::AlignCenter);
     wheelLayout->addWidget(wheelResultLabel, 0, Qt::AlignCenter);
     wheelLayout->addSpacing(-5);
-    wheelLayout->addWidget(guessedLettersBox, 0, Qt::AlignCenter);
+    wheelLayout->addWidget(letterBoard, 0, Qt::AlignCenter);
     wheelLayout->addStretch();
     wheelLayout->setAlignment(Qt::AlignCenter);
 
@@ -386,8 +438,8 @@ void GameController::setUpUI() {
 
     // --- Bottom action buttons ---
     spinButton = new QPushButton("Spin Wheel", this);
-    buyVowelButton = new QPushButton("Buy Vowel (3 gems)", this);
-    buyHintButton = new QPushButton("Buy Hint (5 gems)", this);
+    buyVowelButton = new QPushButton(QString("Buy Vowel (%1 gems)").arg(rules.vowelCost), this);
+    buyHintButton = new QPushButton(QString("Buy Hint (%1 gems)").arg(rules.hintCost), this);
     solveButton = new QPushButton("Solve Phrase", this);
 
     // Set button sizes
@@ -447,315 +499,200 @@ void GameController::setUpUI() {
     // --- Main layout ---
     QVBoxLayout *mainLayout = new QVBoxLayout(this);
     mainLayout->addWidget(categoryLabel);
-    mainLayout->addWidget(phraseLabel);
+    mainLayout->addWidget(phraseBoard);
     mainLayout->addLayout(wheelRow);
-    mainLayout->addSpacing(15); // spacing to lift guessed letters above buttons
     mainLayout->addLayout(bottomButtons);
     mainLayout->setSpacing(20);
 
     setLayout(mainLayout);
 
-    // --- Start message box before timer ---
-    QTimer::singleShot(0, this, [this]() {
-        QMessageBox *msg = new QMessageBox(this);
-        msg->setWindowTitle("How to Play");
-        msg->setText(
-            "Click the \"Spin Wheel\" button in the bottom left corner "
-            "to begin guessing letters and play the game."
-            );
-        msg->setIcon(QMessageBox::Information);
-        msg->setStandardButtons(QMessageBox::Ok);
-
-        activeDialogs.append(msg);
+    // Prompts are drawn over everything else on the screen
+    prompt = new PromptOverlay(this);
 
-        connect(msg, &QDialog::finished, this, [=]() {
-            activeDialogs.removeOne(msg);
-            msg->deleteLater();
-
-            // Start timer AFTER user clicks OK
-            if (gameTimer && !gameTimer->isActive())
-                gameTimer->start(1000);
-        });
-
-        msg->open();
-    });
+    // --- Start message before timer ---
+    prompt->ask("How to Play",
+                "Click the \"Spin Wheel\" button in the bottom left corner "
+                "to begin guessing letters and play the game. Type a letter "
+                "or click it on the letter board to guess it.",
+                "OK", QString(),
+                [this](bool, const QString &) { resumePlay(); });  // the clock starts here
 }
 
 // Game actions
 void GameController::spinWheel()
 {
-    if (wheel) wheel->spinWheel();
+    if (!wheel || wheel->isSpinning() || !catchUpClock()) return;
+
+    if (session.spin() == GameSession::Result::Ok) {
+        letterBoard->setMode(LetterBoard::Locked);  // a vowel that was not picked yet is put back
+        wheelResultLabel->clear();
+        wheel->spinTo(session.pendingSegment());
+    }
+    else if (session.phase() == GameSession::Phase::Consonant)
+        startLetterGuessing();  // the last spin still needs its consonant
+}
+
+// Purchases wait until the consonant of a spin has been guessed
+static bool spinPending(const GameSession &session) {
+    return session.phase() == GameSession::Phase::Consonant;
 }
 
 void GameController::buyVowel() {
 
-    gameActive = false;
+    if (!catchUpClock()) return;
 
-    // Checks whether the user has enough gems to purchase a vowel
-    if (wheel)
-        wheel->stopSpin();
+    if (spinPending(session)) {
+        wheelResultLabel->setText("Guess a consonant for your spin first.");
+        return;
+    }
 
-    if (playerGems.getGems() < 3) {
-        showWarningAndRetry("Not enough gems", "Need 3 gems!", nullptr, false);
-    } else {
+    // Checks whether the user has enough gems to purchase a vowel
+    if (!session.canBuyVowel()) {
+        wheelResultLabel->setText(QString("Need %1 gems!").arg(rules.vowelCost));
+        return;
+    }
 
-        playerGems.spendGems(3);
-
-        auto askVowel = std::make_shared<std::function<void()>>();
-
-        *askVowel = [this, askVowel]() {
-            QInputDialog *dialog = new QInputDialog(this);
-            dialog->setWindowTitle("Buy a Vowel");
-            dialog->setLabelText("Enter a vowel (A, E, I, O, U):");
-            dialog->setTextValue("");
-            dialog->setInputMode(QInputDialog::TextInput);
-            dialog->setModal(true);
-
-            activeDialogs.append(dialog);
-
-            connect(dialog, &QInputDialog::textValueSelected, this, [=](const QString &guess) {
-                dialog->deleteLater();
-                activeDialogs.removeOne(dialog);
-
-                // Validation for guessing a vowel
-                if (guess.isEmpty() || guess.length() != 1 || !guess[0].isLetter()) {
-                    showWarningAndRetry("Invalid Input", "Enter a single vowel.", *askVowel, true);
-                    return;
-                }
-
-                QChar letter = guess[0].toUpper();
-
-                if (!QString("AEIOU").contains(letter)) {
-                    showWarningAndRetry("Invalid Input", "That's not a vowel.", *askVowel, true);
-                    return;
-                }
-
-                if (guessedLetters.contains(letter)) {
-                    showWarningAndRetry("Already Guessed", "This letter was already guessed.", *askVowel, true);
-                    return;
-                }
-
-                guessedLetters.insert(letter);;
-
-                QString lettersText = "Guessed Letters: ";
-                for (auto l : guessedLetters) lettersText += QString(l) + " ";
-                guessedLettersBox->setText(lettersText);
-
-                // Guess the letter
-                if (phraseHandler->guessLetter(letter)) {
-                    updateDisplayedPhrase();
-                    if (phraseHandler->isComplete()) {
-                        showWarningAndRetry("You Win!", "You guessed the full phrase!", nullptr, false);
-                    }
-                } else {
-                    showWarningAndRetry("Incorrect", "The letter is not in the phrase.", nullptr, false);
-                }
-            });
-
-            dialog->open();
-        };
-        (*askVowel)();
+    // Clicking again puts the vowel back, the gems are only spent once one is picked
+    if (letterBoard->mode() == LetterBoard::Vowels) {
+        letterBoard->setMode(LetterBoard::Locked);
+        wheelResultLabel->clear();
+        return;
     }
-    gameActive = true;
+
+    letterBoard->setMode(LetterBoard::Vowels);
+    wheelResultLabel->setText(QString("Pick a vowel for %1 gems").arg(rules.vowelCost));
 }
 
 void GameController::buyHint() {
-    gameActive = false;
-
-    if (wheel)
-        wheel->stopSpin();
+    if (!catchUpClock()) return;
 
-    // Max 3 hints per round
-    const int maxHints = 3;
-
-    // Already used all 3 hints?
-    if (currentHintIndex >= maxHints) {
-        showWarningAndRetry("No more hints", "You have already used all 3 hints for this phrase.", nullptr, false);
-        gameActive = true;
+    if (spinPending(session)) {
+        wheelResultLabel->setText("Guess a consonant for your spin first.");
         return;
     }
 
-    // Using a free hint
-    if (freeHintsCount > 0) {
-        QMessageBox::StandardButton reply = QMessageBox::question(
-            this,
-            "Use Free Hint",
-            "You have a free hint! Do you want to use it?",
-            QMessageBox::Yes | QMessageBox::No
-            );
-
-        if (reply == QMessageBox::Yes) {
-            freeHintsCount--;
-            freeHintsLabel->setText("Free Hints: " + QString::number(freeHintsCount));
-
-            QString hintText = hintsForCurrentPhrase[currentHintIndex];
-            currentHintIndex++;
+    // Already used all hints? (phrases from a pack may carry fewer)
+    if (session.hintsLeft() <= 0) {
+        wheelResultLabel->setText("You have already used all the hints for this phrase.");
+        return;
+    }
 
-            showWarningAndRetry("Hint", hintText, nullptr, false);
-        }
+    // Using a free hint, the clock stops while the player decides
+    if (session.freeHints() > 0) {
+        setFlow(Flow::Paused);
+        prompt->ask("Use Free Hint", "You have a free hint! Do you want to use it?", "Use It", "Not Now",
+                    [this](bool use, const QString &) {
+            resumePlay();
+            if (use)
+                session.buyHint();
+        });
     }
 
     // No free hint since not enough gems
-    else if (playerGems.getGems() < 5) {
-        showWarningAndRetry("Not enough gems", "You need 5 gems or a free hint!", nullptr, false);
+    else if (!session.canBuyHint()) {
+        wheelResultLabel->setText(QString("You need %1 gems or a free hint!").arg(rules.hintCost));
     }
 
     // Buying a hint with gems
     else {
-        playerGems.spendGems(5);
-
-        QString hintText = hintsForCurrentPhrase[currentHintIndex];
-        currentHintIndex++;
-
-        showWarningAndRetry("Hint:", hintText, nullptr, false);
+        session.buyHint();
     }
-
-    gameActive = true;
 }
 
 
 void GameController::solvePhrase()
 {
-    if (!phraseHandler || !gameActive) return;  // don't proceed if game ended
+    if (!catchUpClock()) return;  // don't proceed if game ended
 
-    // Stop the game
-    gameActive = false;
-
-    if (gameTimer->isActive())
-        gameTimer->stop();
+    // The clock stops while the player types
+    setFlow(Flow::Paused);
 
     if (wheel)
         wheel->stopSpin();
 
-    closeAllDialogs();          // close any open dialogs
-    letterDialogOpen = false;   // reset letter input flag
-
-    bool ok;
-    QString playerInput = QInputDialog::getText(this, "Solve Phrase",
-                                                "Enter the full phrase:",
-                                                QLineEdit::Normal, "", &ok);
-
-    if (!ok || playerInput.isEmpty()) {
-        gameActive = true;       // resume game if player cancels
-        if (gameTimer) gameTimer->start(1000);
-        return;
-    }
-
-    QString inputUpper = playerInput.toUpper();
-    QString phraseUpper = phraseHandler->getOriginalPhrase().toUpper();
-
-    if (inputUpper == phraseUpper) {
-        phraseHandler->revealPhrase();
-        updateDisplayedPhrase();
-
-        // Custom end-game dialog
-        QMessageBox *msg = new QMessageBox(this);
-        msg->setWindowTitle("You Won!");
-        msg->setText("Congratulations! You guessed the full phrase correctly!");
-        msg->setStandardButtons(QMessageBox::Ok | QMessageBox::Cancel);
-        msg->button(QMessageBox::Ok)->setText("Return to Main Menu");
-        msg->button(QMessageBox::Cancel)->setText("Exit Game");
-
-        activeDialogs.append(msg);
-        connect(msg, &QDialog::finished, this, [=](int result){
-            activeDialogs.removeOne(msg);
-            msg->deleteLater();
-
-            if (result == QMessageBox::Ok)
-                returnToMainMenu(true);
-            else
-                qApp->quit();
-        });
+    prompt->askText("Solve Phrase", "Enter the full phrase:", "Solve", "Cancel",
+                    [this](bool accepted, const QString &playerInput) {
+        if (!accepted || playerInput.isEmpty()) {
+            resumePlay();       // resume game if player cancels
+            return;
+        }
 
-        msg->open();
+        // A wrong guess costs time (see GameRules), a right one ends the round; both are
+        // reported through the session events
+        const QByteArray guess = playerInput.toLatin1();
+        session.solve(std::string_view(guess.constData(), static_cast<std::size_t>(guess.size())));
 
-    } else {
-        remainingTime -= 5; // an incorrect guess costs 5 seconds of users time
-        if (remainingTime < 0) remainingTime = 0;
-        updateTimerLabel();
+        // A wrong guess also forfeits a pending spin, so the consonant pick goes away; the
+        // status line already tells why
+        if (!session.isOver() && session.phase() != GameSession::Phase::Consonant
+            && letterBoard->mode() == LetterBoard::Consonants)
+            letterBoard->setMode(LetterBoard::Locked);
 
-        // Incorrect guess
-        showWarningAndRetry("Incorrect", "Sorry, that was not correct. Keep playing!", nullptr, false);
-        gameActive = true;
-        if (gameTimer) gameTimer->start(1000);
-    }
-}
-
-// Utility Functions
-void GameController::closeAllDialogs() {
-    for (QDialog* dlg : activeDialogs) {
-        if (dlg) {
-            dlg->close();
-            dlg->deleteLater();
-        }
-    }
-    activeDialogs.clear();
+        if (flow == Flow::Paused)
+            resumePlay();
+    });
 }
 
 void GameController::startNewGame() {
 
     // 1. Reset guessed letters
-    guessedLetters.clear();
-    guessedLettersBox->clear();
+    letterBoard->setMode(LetterBoard::Locked);
 
-    // 2. Reset free hints
-    freeHintsCount = 0;
-    freeHintsLabel->setText("Free Hints: 0");
-
-    // 3. Reset wheel result label
+    // 2. Reset wheel result label
     wheelResultLabel->setText("");
 
-    // 4. Reset phrase
+    // 3. New phrase; the session resets gems, free hints and the clock, and its events update
+    //    their labels
     initializePhrase();      // picks a new random phrase
     updateDisplayedPhrase(); // updates the UI
+    updateGuessedLetters();
 
-    // 5. Reset timer based on difficulty
-    remainingTime = (difficulty == 0) ? 120 : 180;
-    int minutes = remainingTime / 60;
-    int seconds = remainingTime % 60;
-    timerLabel->setText(QString("Time: %1:%2")
-                            .arg(minutes)
-                            .arg(seconds, 2, 10, QChar('0')));
-
-    // 6. Restart the timer
-    if (gameTimer->isActive()) gameTimer->stop();
-
-    gameTimer->start(1000);
-
-    // 7. Reset player gems
-    playerGems.resetGems(0);
+    // 4. Restart the timer
+    clock.reset();
+    setFlow(Flow::Playing);
 }
 
 
 void GameController::returnToMainMenu(bool skipConfirmation) {
 
-    if (gameTimer && gameTimer->isActive())
-        gameTimer->stop();
+    if (skipConfirmation) {
+        leaveToMainMenu();
+        return;
+    }
+
+    // Other prompts cover the button, but a second click may still be queued
+    if (flow != Flow::Playing)
+        return;
 
-    gameActive = false;
+    setFlow(Flow::Paused);
 
     if (wheel)
         wheel->stopSpin();
 
     // Handles exiting the game and returning to the home screen
-    if (!skipConfirmation) {
-        QMessageBox::StandardButton reply = QMessageBox::question(
-            this,
-            "Exit Game",
-            "Are you sure you want to exit the game?",
-            QMessageBox::Yes | QMessageBox::No
-            );
+    prompt->ask("Exit Game", "Are you sure you want to exit the game?", "Exit", "Keep Playing",
+                [this](bool exit, const QString &) {
+        if (exit)
+            leaveToMainMenu();
+        else
+            resumePlay();   // User cancelled exit, just continue the game
+    });
+}
 
-        if (reply == QMessageBox::No) {
-            // User cancelled exit, just continue the game
-            gameActive = true;
-            if (gameTimer && !gameTimer->isActive())
-                gameTimer->start(1000);
-            return;
-        }
-    }
+void GameController::leaveToMainMenu() {
+    if (flow == Flow::Leaving)
+        return;
 
-    closeAllDialogs();
+    setFlow(Flow::Leaving);
+
+    if (wheel)
+        wheel->stopSpin();
+
+    prompt->dismiss();
+
+    // The closed window is never deleted, so an abandoned round is written out here
+    session.setLog(nullptr);
+    sessionLog.reset();
 
     MainController *mainMenu = new MainController();
     mainMenu->setWindowTitle("Spin & Solve");
@@ -772,34 +709,27 @@ void GameController::openHelpScreen()
     helpScreen->show();
 }
 
+// Asks what comes after a round. The flow is already RoundOver, so the clock has stopped and
+// nothing else can end the round again.
 void GameController::endGame(const QString &title, const QString &message)
 {
-    // Stop timer
-    if (gameTimer->isActive())
-        gameTimer->stop();
-
-    // Close all dialogs
-    closeAllDialogs();
+    letterBoard->setMode(LetterBoard::Locked);
 
     // Ask player what to do
-    QMessageBox::StandardButton reply = QMessageBox::question(
-        this,
-        title,
-        message,
-        QMessageBox::Yes | QMessageBox::No
-        );
-
-    if (reply == QMessageBox::Yes)
-        startNewGame();
-    else
-        returnToMainMenu(false);
+    prompt->ask(title, message + "\n\nDo you want to start a new game?", "New Game", "Main Menu",
+                [this](bool newGame, const QString &) {
+        if (newGame)
+            startNewGame();
+        else
+            leaveToMainMenu();
+    });
 }
 
 
 void GameController::paintEvent(QPaintEvent *event)
 {
+    // Pre-scaled to the window size, so this is a plain copy
     QPainter painter(this);
-    QPixmap background(":/images/images/background.png");
     painter.drawPixmap(rect(), background);
 
     QWidget::paintEvent(event);
@@ -1,18 +1,26 @@
 #ifndef GAMECONTROLLER_H
 #define GAMECONTROLLER_H
 
+#include "GameClock.h"
+#include "GameRules.h"
+#include "GameSession.h"
+#include "LetterBoard.h"
 #include "Wheel.h"
-#include "PlayerGems.h"
-#include "PhraseHandler.h"
-#include "PhraseLibrary.h"  // Needed to access Phrase class
+#include "PhraseBoardWidget.h"
+#include "PhraseSelector.h"
+#include "PromptOverlay.h"
+#include "Random.h"
+#include "SessionLog.h"
 
 #include <QWidget>
 #include <QLabel>
-#include <QLineEdit>
+#include <QPixmap>
 #include <QPushButton>
-#include <QSet>
-#include <QMessageBox>
 
+#include <memory>
+
+// The game screen. The rules live in the GameSession; this class turns clicks and dialogs
+// into session commands and session events into label updates and messages.
 class GameController : public QWidget {
     Q_OBJECT
 
@@ -20,29 +28,49 @@ public:
     explicit GameController(int diff, QWidget *parent = nullptr);
 
 private:
+    // Where the screen is in the game. Nothing here blocks: questions are overlay prompts and
+    // their answers move the flow on. The clock only runs while Playing, and only Playing
+    // accepts commands, so a round can end (and ask what next) only once.
+    enum class Flow {
+        Intro,      // how-to-play prompt, before the clock starts
+        Playing,
+        Paused,     // a prompt (solve, free hint, exit) waits for an answer
+        RoundOver,  // the round is decided, the new game / main menu prompt is up
+        Leaving     // on the way back to the main menu
+    };
+
     // Game state
+    const GameRules &rules = GameRules::active();
+    Flow flow = Flow::Intro;
     int difficulty;
-    int freeHintsCount = 0;
-    QString phrase;
-    QString displayedPhrase;
-    QSet<QChar> guessedLetters;
     bool bypassCloseConfirm = false;
-    bool letterDialogOpen = false;
-    bool gameActive = true;
 
-    PhraseHandler *phraseHandler = nullptr;
+    // Every random choice of the session (phrases, wheel) comes from this generator, so a
+    // session can be replayed from its seed
+    std::uint64_t sessionSeed = Random::freshSeed();
+    Random random{sessionSeed};
+
+    // The game has no player accounts yet, so every session shares the default history
+    PhraseHistory phraseHistory{"default"};
+    PhraseSelector phraseSelector{&phraseHistory, random.next()};
+
+    // Every command of the session is recorded, see tools/replay; declared before the session
+    // so that it outlives it
+    std::unique_ptr<SessionLogWriter> sessionLog;
+    GameSession session{rules, random.next()};
+
     Wheel *wheel = nullptr;
-    PlayerGems playerGems;
 
     // UI elements
-    QLabel *phraseLabel = nullptr;
+    QPixmap background;
+    PhraseBoardWidget *phraseBoard = nullptr;
     QLabel *gemsLabel = nullptr;
     QLabel *categoryLabel = nullptr;
     QLabel *wheelResultLabel = nullptr;
     QLabel *freeHintsLabel = nullptr;
     QLabel *timerLabel = nullptr;
 
-    QLineEdit *guessedLettersBox = nullptr;
+    LetterBoard *letterBoard = nullptr;
 
     QPushButton *spinButton = nullptr;
     QPushButton *buyVowelButton = nullptr;
@@ -50,42 +78,44 @@ private:
     QPushButton *mainMenuButton = nullptr;
     QPushButton *helpButton = nullptr;
     QPushButton *solveButton = nullptr;
+    PromptOverlay *prompt = nullptr;
 
-    // Timer management
+    // Timer management: the clock measures the round, the timer only wakes the screen up when
+    // the displayed second is about to change
+    GameClock clock;
     QTimer *gameTimer = nullptr;
-    int remainingTime;
-    QString timeText;
-
-    // Dialog Tracking
-    QList<QMessageBox*> activeMessageBoxes;
-    QList<QDialog*> activeDialogs;
+    int displayedSeconds = -1;
+    bool timeRunningOut = false;
 
 private:
     // Setup/ Initialization
+    void openSessionLog();
     void setUpWheel();
     void setUpUI();
     void initializePhrase();
     void setUpLabels();
 
-    // Rendering
+    // Rendering and input
     void paintEvent(QPaintEvent *event);
+    void keyPressEvent(QKeyEvent *event) override;
 
     // Game Logic
+    void setFlow(Flow next);
+    void resumePlay();
+    void handleSessionEvent(const GameSession::Event &event);
     void updateDisplayedPhrase();
+    void updateGuessedLetters();
+    bool catchUpClock();
+    void scheduleClock();
     void updateTimer();
     void updateTimerLabel();
-    void handleGuess();
     void startNewGame();
     void endGame(const QString &title, const QString &message);
-    void askForLetter();
-    void startLetterGuessing(const QString &landedSegment);
-    void showWarningAndRetry(const QString &title, const QString &text, std::function<void()> retry, bool retryDialog);
-    void handleWheelReward(const QString &landedSegment);
-    void handleIncorrectGuess(const QString &landedSegment);
-    void closeAllDialogs();
-
-    int currentHintIndex = 0;
-    QStringList hintsForCurrentPhrase;
+    void timeUp();
+    void leaveToMainMenu();
+    void startLetterGuessing();
+    void chooseLetter(char letter);
+    void showHint(const QString &text);
 
 private slots:
     // Slots
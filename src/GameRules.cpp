@@ -0,0 +1,42 @@
+// This file defines the economy and timing rules of a game
+
+#include "GameRules.h"
+
+#include <QCoreApplication>
+#include <QDebug>
+#include <QFileInfo>
+
+const GameRules &GameRules::standard() {
+    static const GameRules rules = []() {
+        std::vector<WheelSegment> segments;
+        for (const char *label : { "2 gems", "-5 seconds", "3 gems", "Free Hint",
+                                   "1 gem", "-10 seconds", "2 gems", "4 gems" }) {
+            WheelSegment segment;
+            WheelSegment::parse(label, segment);
+            segments.push_back(segment);
+        }
+
+        GameRules standardRules;
+        standardRules.wheel = WheelDefinition(std::move(segments), ":/images/images/pink.png");
+        return standardRules;
+    }();
+    return rules;
+}
+
+const GameRules &GameRules::active() {
+    static const GameRules rules = []() {
+        GameRules activeRules = standard();
+
+        const QString path = QCoreApplication::applicationDirPath() + "/wheel.json";
+        if (QFileInfo::exists(path)) {
+            QString error;
+            WheelDefinition wheel;
+            if (WheelDefinition::load(path, wheel, &error))
+                activeRules.wheel = wheel;
+            else
+                qWarning() << "Ignoring wheel definition:" << error;
+        }
+        return activeRules;
+    }();
+    return rules;
+}
@@ -0,0 +1,29 @@
+#ifndef GAMERULES_H
+#define GAMERULES_H
+
+#include "WheelDefinition.h"
+
+// Economy and timing constants shared by the game and the simulator
+struct GameRules {
+    int startingGems = 0;
+    int vowelCost = 3;
+    int hintCost = 5;
+    int maxHints = 3;                  // per phrase
+    int easySeconds = 120;
+    int hardSeconds = 180;
+    int wrongSolvePenaltySeconds = 5;
+
+    // A correct letter earns the gems or free hint of the slice the wheel landed on, a wrong
+    // letter costs its time
+    WheelDefinition wheel;
+
+    int roundSeconds(int difficulty) const { return difficulty == 0 ? easySeconds : hardSeconds; }
+
+    // The rules the game ships with
+    static const GameRules &standard();
+
+    // The standard rules with the wheel from a "wheel.json" next to the executable, if any
+    static const GameRules &active();
+};
+
+#endif // GAMERULES_H
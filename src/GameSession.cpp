@@ -0,0 +1,266 @@
+// This file implements the rules of a round of Spin & Solve as a UI-free state machine
+
+#include "GameSession.h"
+#include "SessionLog.h"
+
+#include <algorithm>
+
+static char upper(char c) {
+    return (c >= 'a' && c <= 'z') ? static_cast<char>(c - 'a' + 'A') : c;
+}
+
+GameSession::GameSession(const GameRules &rules, std::uint64_t seed)
+    : rules(rules), random(seed), sessionSeed(seed)
+{
+}
+
+bool GameSession::isVowel(char letter) {
+    switch (upper(letter)) {
+    case 'A': case 'E': case 'I': case 'O': case 'U':
+        return true;
+    default:
+        return false;
+    }
+}
+
+void GameSession::emitEvent(Event::Type type, std::int64_t value, char letter) {
+    if (listener)
+        listener(Event{ type, value, letter });
+}
+
+void GameSession::start(int difficulty, Phrase phrase) {
+    this->phrase = std::move(phrase);
+    phraseBoard = PhraseBoard(this->phrase.text);
+    currentPhase = Phase::Spin;
+    roundDifficulty = difficulty;
+    gemCount = rules.startingGems;
+    freeHintCount = 0;
+    hintCount = 0;
+    segment = -1;
+    remaining = std::int64_t(rules.roundSeconds(difficulty)) * 1000;
+
+    emitEvent(Event::GemsChanged, gemCount);
+    emitEvent(Event::FreeHintsChanged, freeHintCount);
+    emitEvent(Event::TimeChanged, remaining);
+
+    if (log)
+        log->start(difficulty, this->phrase);
+}
+
+int GameSession::hintsLeft() const {
+    const int available = std::min(rules.maxHints, static_cast<int>(phrase.hints.size()));
+    return std::max(0, available - hintCount);
+}
+
+bool GameSession::canBuyHint() const {
+    return currentPhase == Phase::Spin && hintsLeft() > 0 && (freeHintCount > 0 || gemCount >= rules.hintCost);
+}
+
+PhraseBoard::DirtyRange GameSession::takeDirtyRange() {
+    const PhraseBoard::DirtyRange dirty = phraseBoard.dirtyRange();
+    phraseBoard.clearDirty();
+    return dirty;
+}
+
+// The outcome is decided here; the wheel on screen only animates towards it
+GameSession::Result GameSession::applySpin() {
+    if (currentPhase != Phase::Spin || rules.wheel.isEmpty())
+        return Result::NotNow;
+
+    segment = rules.wheel.sample(random.next());
+    currentPhase = Phase::Consonant;
+    emitEvent(Event::SpinLanded, segment);
+    return Result::Ok;
+}
+
+// Every command is logged with its result, refused ones included, so a replay can check it
+GameSession::Result GameSession::spin() {
+    const bool wasOver = isOver();
+    const Result result = applySpin();
+    if (log)
+        log->spin(result, segment);
+    flushLogIfDecided(wasOver);
+    return result;
+}
+
+GameSession::Result GameSession::guessConsonant(char letter) {
+    const bool wasOver = isOver();
+    const Result result = applyConsonant(letter);
+    if (log)
+        log->consonant(letter, result);
+    flushLogIfDecided(wasOver);
+    return result;
+}
+
+GameSession::Result GameSession::buyVowel(char letter) {
+    const bool wasOver = isOver();
+    const Result result = applyVowel(letter);
+    if (log)
+        log->vowel(letter, result);
+    flushLogIfDecided(wasOver);
+    return result;
+}
+
+GameSession::Result GameSession::buyHint() {
+    const bool wasOver = isOver();
+    const Result result = applyHint();
+    if (log)
+        log->hint(result);
+    flushLogIfDecided(wasOver);
+    return result;
+}
+
+GameSession::Result GameSession::solve(std::string_view guess) {
+    const bool wasOver = isOver();
+    const Result result = applySolve(guess);
+    if (log)
+        log->solve(guess, result);
+    flushLogIfDecided(wasOver);
+    return result;
+}
+
+// The log is flushed once the round is decided, after the deciding command has been recorded
+void GameSession::flushLogIfDecided(bool wasOver) {
+    if (log && !wasOver && isOver())
+        log->flush();
+}
+
+GameSession::Result GameSession::checkLetter(char letter) const {
+    const char c = upper(letter);
+    if (c < 'A' || c > 'Z')
+        return Result::InvalidLetter;
+    if (phraseBoard.isGuessed(c))
+        return Result::AlreadyGuessed;
+    return Result::Ok;
+}
+
+void GameSession::reveal(char letter) {
+    const int revealed = phraseBoard.guess(letter);
+    if (revealed > 0)
+        emitEvent(Event::LetterRevealed, revealed, letter);
+    else
+        emitEvent(Event::LetterMissed, 0, letter);
+}
+
+// A correct consonant earns the slice's gems or free hint, a wrong one costs its time
+GameSession::Result GameSession::applyConsonant(char letter) {
+    if (currentPhase != Phase::Consonant)
+        return Result::NotNow;
+
+    const char c = upper(letter);
+    if (c >= 'A' && c <= 'Z' && isVowel(c))
+        return Result::NotConsonant;
+    const Result check = checkLetter(c);
+    if (check != Result::Ok)
+        return check;
+
+    const WheelSegment &landed = rules.wheel.segment(segment);
+    currentPhase = Phase::Spin;
+    reveal(c);
+
+    if (phraseBoard.contains(c)) {
+        if (landed.kind == WheelSegment::Gems) {
+            gemCount += landed.value;
+            emitEvent(Event::GemsChanged, gemCount);
+        } else if (landed.kind == WheelSegment::FreeHint) {
+            freeHintCount++;
+            emitEvent(Event::FreeHintsChanged, freeHintCount);
+        }
+        if (phraseBoard.isComplete())
+            finish(Phase::Won, true);
+    } else if (landed.kind == WheelSegment::TimePenalty) {
+        penalize(std::int64_t(landed.value) * 1000);
+    }
+    return Result::Ok;
+}
+
+// The letter is checked before any gems are spent
+GameSession::Result GameSession::applyVowel(char letter) {
+    if (currentPhase != Phase::Spin)
+        return Result::NotNow;
+
+    const char c = upper(letter);
+    if (c >= 'A' && c <= 'Z' && !isVowel(c))
+        return Result::NotVowel;
+    const Result check = checkLetter(c);
+    if (check != Result::Ok)
+        return check;
+    if (gemCount < rules.vowelCost)
+        return Result::NotEnoughGems;
+
+    gemCount -= rules.vowelCost;
+    emitEvent(Event::GemsChanged, gemCount);
+    reveal(c);
+
+    if (phraseBoard.isComplete())
+        finish(Phase::Won, true);
+    return Result::Ok;
+}
+
+GameSession::Result GameSession::applyHint() {
+    if (currentPhase != Phase::Spin)
+        return Result::NotNow;
+    if (hintsLeft() <= 0)
+        return Result::NoHintsLeft;
+
+    if (freeHintCount > 0) {
+        freeHintCount--;
+        emitEvent(Event::FreeHintsChanged, freeHintCount);
+    } else if (gemCount >= rules.hintCost) {
+        gemCount -= rules.hintCost;
+        emitEvent(Event::GemsChanged, gemCount);
+    } else {
+        return Result::NotEnoughGems;
+    }
+
+    emitEvent(Event::HintRevealed, hintCount);
+    hintCount++;
+    return Result::Ok;
+}
+
+GameSession::Result GameSession::applySolve(std::string_view guess) {
+    if (isOver())
+        return Result::NotNow;
+
+    currentPhase = Phase::Spin;
+
+    const std::string &text = phraseBoard.text();
+    const bool correct = guess.size() == text.size()
+                         && std::equal(text.begin(), text.end(), guess.begin(),
+                                       [](char a, char b) { return upper(a) == upper(b); });
+    if (correct) {
+        phraseBoard.revealAll();
+        finish(Phase::Won, false);
+    } else {
+        emitEvent(Event::SolveFailed);
+        penalize(std::int64_t(rules.wrongSolvePenaltySeconds) * 1000);
+    }
+    return Result::Ok;
+}
+
+void GameSession::tick(std::int64_t elapsedMillis) {
+    if (isOver() || elapsedMillis <= 0)
+        return;
+    if (log)
+        log->tick(elapsedMillis);
+    penalize(elapsedMillis);
+    flushLogIfDecided(false);
+}
+
+void GameSession::penalize(std::int64_t millis) {
+    remaining = std::max<std::int64_t>(0, remaining - millis);
+    emitEvent(Event::TimeChanged, remaining);
+    if (remaining == 0)
+        finish(Phase::Lost, false);
+}
+
+// A lost round shows its phrase
+void GameSession::finish(Phase result, bool byLetter) {
+    currentPhase = result;
+    if (result == Phase::Lost) {
+        phraseBoard.revealAll();
+        emitEvent(Event::Lost);
+    } else {
+        emitEvent(Event::Won, byLetter ? 1 : 0);
+    }
+}
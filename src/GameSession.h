@@ -0,0 +1,146 @@
+#ifndef GAMESESSION_H
+#define GAMESESSION_H
+
+#include "GameRules.h"
+#include "PhraseBoard.h"
+#include "Random.h"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class SessionLogWriter;
+
+// The rules of a round of Spin & Solve, without any UI. Commands (spin, guessConsonant,
+// buyVowel, buyHint, solve, tick) check whether they are allowed, change the state and report
+// what happened as events. The game screen, the simulator and tests all drive this class, so
+// there is one implementation of the rules. Time only passes through tick(), in milliseconds.
+class GameSession {
+public:
+    // Waiting for a spin, waiting for the consonant of the spin that just landed, or over
+    enum class Phase { Spin, Consonant, Won, Lost };
+
+    // Why a command was refused. A refused command changes nothing.
+    enum class Result {
+        Ok,
+        NotNow,          // not allowed in the current phase
+        InvalidLetter,   // not a letter from A to Z
+        NotConsonant,
+        NotVowel,
+        AlreadyGuessed,
+        NotEnoughGems,
+        NoHintsLeft
+    };
+
+    struct Event {
+        enum Type {
+            SpinLanded,       // value: wheel segment
+            LetterRevealed,   // letter, value: cells revealed
+            LetterMissed,     // letter
+            GemsChanged,      // value: gems
+            FreeHintsChanged, // value: free hints
+            HintRevealed,     // value: hint index, see hint()
+            TimeChanged,      // value: milliseconds left
+            SolveFailed,
+            Won,              // value: 1 if the last letter completed the board, 0 if solved
+            Lost
+        };
+
+        Type type;
+        std::int64_t value = 0;
+        char letter = 0;
+    };
+
+    using Listener = std::function<void(const Event &)>;
+
+    // A phrase as the session plays it. The text is one byte per board cell (Latin-1).
+    struct Phrase {
+        std::string text;
+        int id = -1;          // library id, -1 if the phrase is not from the library
+        int categoryId = -1;
+        std::vector<std::string> hints;
+    };
+
+    // Wheel outcomes come from a generator seeded here, so a session replays from its seed
+    GameSession(const GameRules &rules, std::uint64_t seed);
+
+    std::uint64_t seed() const { return sessionSeed; }
+
+    // Called synchronously for every event, inside the command that caused it
+    void setListener(Listener listener) { this->listener = std::move(listener); }
+
+    // Records every command from now on (see SessionLog.h); null stops recording. The writer
+    // must have been created with this session's rules and seed and outlive the session.
+    void setLog(SessionLogWriter *writer) { log = writer; }
+
+    // Starts a new round: the gems, free hints, hints and clock of the previous one are reset
+    void start(int difficulty, Phrase phrase);
+
+    Result spin();
+    Result guessConsonant(char letter);
+    Result buyVowel(char letter);
+    Result buyHint();                    // uses a free hint if there is one, gems otherwise
+    Result solve(std::string_view guess); // case-insensitive; a pending spin is forfeited
+    void tick(std::int64_t elapsedMillis);
+
+    Phase phase() const { return currentPhase; }
+    bool isOver() const { return currentPhase == Phase::Won || currentPhase == Phase::Lost; }
+    int difficulty() const { return roundDifficulty; }
+
+    int gems() const { return gemCount; }
+    int freeHints() const { return freeHintCount; }
+    int hintsUsed() const { return hintCount; }
+    int hintsLeft() const;
+    const std::string &hint(int index) const { return phrase.hints[static_cast<std::size_t>(index)]; }
+    std::int64_t remainingMillis() const { return remaining; }
+
+    // Segment the last spin landed on, -1 before the first spin
+    int pendingSegment() const { return segment; }
+
+    bool canBuyVowel() const { return currentPhase == Phase::Spin && gemCount >= rules.vowelCost; }
+    bool canBuyHint() const;
+
+    const Phrase &currentPhrase() const { return phrase; }
+    const PhraseBoard &board() const { return phraseBoard; }
+
+    // Cells revealed since the last call, for a display that only redraws what changed
+    PhraseBoard::DirtyRange takeDirtyRange();
+
+    const GameRules &gameRules() const { return rules; }
+
+    static bool isVowel(char letter);
+
+private:
+    Result applySpin();
+    Result applyConsonant(char letter);
+    Result applyVowel(char letter);
+    Result applyHint();
+    Result applySolve(std::string_view guess);
+
+    void emitEvent(Event::Type type, std::int64_t value = 0, char letter = 0);
+    Result checkLetter(char letter) const;
+    void reveal(char letter);
+    void penalize(std::int64_t millis);
+    void finish(Phase result, bool byLetter);
+    void flushLogIfDecided(bool wasOver);
+
+    const GameRules &rules;
+    Random random;
+    std::uint64_t sessionSeed;
+    Listener listener;
+    SessionLogWriter *log = nullptr;
+
+    Phrase phrase;
+    PhraseBoard phraseBoard;
+    Phase currentPhase = Phase::Lost;  // nothing to play before start()
+    int roundDifficulty = 0;
+    int gemCount = 0;
+    int freeHintCount = 0;
+    int hintCount = 0;
+    int segment = -1;
+    std::int64_t remaining = 0;
+};
+
+#endif // GAMESESSION_H
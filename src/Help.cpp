@@ -1,10 +1,10 @@
 // This file implements the Help page during gameplay to assit players with any difficulties they may encounter
 
 #include "Help.h"
+#include "AssetManager.h"
 
 #include <QVBoxLayout>
 #include <QHBoxLayout>
-#include <QPixmap>
 #include <QTimer>
 
 // The Help class is a QWidget window that shows players how to play the game.
@@ -17,8 +17,7 @@ Help::Help(QWidget *parent)
     // Background image
     // Background image using QLabel
     QLabel *background = new QLabel(this);
-    QPixmap pix(":/images/images/Instructions.png");
-    background->setPixmap(pix.scaled(size(), Qt::IgnoreAspectRatio, Qt::SmoothTransformation));
+    background->setPixmap(AssetManager::pixmap(":/images/images/Instructions.png"));
     background->setGeometry(0, 0, width(), height());
     background->lower(); // send it behind all other widgets
 
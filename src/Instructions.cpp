@@ -1,10 +1,10 @@
 // This file implements the instructions screen for Spin & Solve
 
 #include "Instructions.h"
+#include "AssetManager.h"
 
 #include <QVBoxLayout>
 #include <QHBoxLayout>
-#include <QPixmap>
 
 Instructions::Instructions(QWidget *parent)
     : QWidget(parent)
@@ -14,8 +14,7 @@ Instructions::Instructions(QWidget *parent)
 
     // Background image
     QLabel *background = new QLabel(this);
-    QPixmap pix(":/images/images/Instructions.png");
-    background->setPixmap(pix.scaled(size(), Qt::IgnoreAspectRatio, Qt::SmoothTransformation));
+    background->setPixmap(AssetManager::pixmap(":/images/images/Instructions.png"));
     background->setGeometry(0, 0, width(), height());
     background->lower();
 
@@ -0,0 +1,122 @@
+// This file draws the on-screen letters of the game screen
+
+#include "LetterBoard.h"
+
+#include <QFont>
+#include <QMouseEvent>
+#include <QPaintEvent>
+#include <QPainter>
+
+static const std::uint32_t vowelMask = (1u << ('A' - 'A')) | (1u << ('E' - 'A')) | (1u << ('I' - 'A'))
+                                       | (1u << ('O' - 'A')) | (1u << ('U' - 'A'));
+
+LetterBoard::LetterBoard(QWidget *parent)
+    : QWidget(parent)
+{
+    // Two rows of 13, A-M above N-Z
+    for (int i = 0; i < 26; i++)
+        keys[i] = QRect((i % columns) * (keyWidth + gap), (i / columns) * (keyHeight + gap), keyWidth, keyHeight);
+
+    setFixedSize(sizeHint());
+    setCursor(Qt::PointingHandCursor);
+    painted.fill(LockedKey);
+}
+
+QSize LetterBoard::sizeHint() const {
+    return QSize(columns * (keyWidth + gap) - gap, 2 * (keyHeight + gap) - gap);
+}
+
+void LetterBoard::setMode(Mode mode) {
+    currentMode = mode;
+    refresh();
+}
+
+void LetterBoard::setGuessed(std::uint32_t guessed, std::uint32_t hits) {
+    guessedMask = guessed;
+    hitMask = hits & guessed;
+    refresh();
+}
+
+LetterBoard::KeyState LetterBoard::stateOf(int letter) const {
+    const std::uint32_t bit = 1u << letter;
+    if (guessedMask & bit)
+        return (hitMask & bit) ? Hit : Missed;
+
+    switch (currentMode) {
+    case Consonants:
+        return (vowelMask & bit) ? LockedKey : Available;
+    case Vowels:
+        return (vowelMask & bit) ? Available : LockedKey;
+    default:
+        return LockedKey;
+    }
+}
+
+bool LetterBoard::isAvailable(char letter) const {
+    if (letter >= 'a' && letter <= 'z')
+        letter = static_cast<char>(letter - 'a' + 'A');
+    return letter >= 'A' && letter <= 'Z' && stateOf(letter - 'A') == Available;
+}
+
+// Schedules a repaint of the keys whose state changed
+void LetterBoard::refresh() {
+    for (int i = 0; i < 26; i++) {
+        if (stateOf(i) != painted[i])
+            update(keys[i]);
+    }
+}
+
+void LetterBoard::paintEvent(QPaintEvent *event) {
+    QPainter painter(this);
+    painter.setRenderHint(QPainter::Antialiasing);
+
+    QFont font("Verdana");
+    font.setBold(true);
+    font.setPixelSize(13);
+    painter.setFont(font);
+
+    for (int i = 0; i < 26; i++) {
+        if (!event->region().intersects(keys[i]))
+            continue;
+
+        const KeyState state = stateOf(i);
+        painted[i] = state;
+
+        QColor background, text;
+        switch (state) {
+        case Available:
+            background = QColor("#bb129b");
+            text = QColor("#efd4ed");
+            break;
+        case LockedKey:
+            background = QColor("#EBD1E5");
+            text = QColor("#5C1F53");
+            break;
+        case Hit:
+            background = QColor("#5C1F53");
+            text = Qt::white;
+            break;
+        case Missed:
+            background = QColor("#EBD1E5");
+            text = QColor("#B9A0B3");
+            break;
+        }
+
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(background);
+        painter.drawRoundedRect(keys[i], 4, 4);
+        painter.setPen(text);
+        painter.drawText(keys[i], Qt::AlignCenter, QString(QChar('A' + i)));
+    }
+}
+
+void LetterBoard::mousePressEvent(QMouseEvent *event) {
+    for (int i = 0; i < 26; i++) {
+        if (keys[i].contains(event->pos())) {
+            if (stateOf(i) == Available)
+                emit letterChosen(static_cast<char>('A' + i));
+            return;
+        }
+    }
+    QWidget::mousePressEvent(event);
+}
@@ -0,0 +1,58 @@
+#ifndef LETTERBOARD_H
+#define LETTERBOARD_H
+
+#include <QRect>
+#include <QWidget>
+
+#include <array>
+#include <cstdint>
+
+// On-screen letters A-Z for guessing with the mouse, next to the keyboard. Each key shows
+// whether its letter can be picked right now: letters already guessed (hit or missed) never
+// can, and the mode locks the vowels while a consonant is wanted and the consonants while a
+// vowel is. Keys are painted directly and a state change repaints only the keys it touched.
+class LetterBoard : public QWidget {
+    Q_OBJECT
+
+public:
+    enum Mode { Locked, Consonants, Vowels };
+
+    explicit LetterBoard(QWidget *parent = nullptr);
+
+    void setMode(Mode mode);
+    Mode mode() const { return currentMode; }
+
+    // Bit i stands for the letter 'A' + i, see PhraseBoard::letterBit
+    void setGuessed(std::uint32_t guessed, std::uint32_t hits);
+
+    bool isAvailable(char letter) const;
+
+    QSize sizeHint() const override;
+
+signals:
+    // Clicked on an available key
+    void letterChosen(char letter);
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+    void mousePressEvent(QMouseEvent *event) override;
+
+private:
+    enum KeyState { Available, LockedKey, Hit, Missed };
+
+    static constexpr int columns = 13;
+    static constexpr int keyWidth = 30;
+    static constexpr int keyHeight = 24;
+    static constexpr int gap = 3;
+
+    KeyState stateOf(int letter) const;
+    void refresh();
+
+    std::array<QRect, 26> keys;
+    std::array<KeyState, 26> painted{};
+    Mode currentMode = Locked;
+    std::uint32_t guessedMask = 0;
+    std::uint32_t hitMask = 0;
+};
+
+#endif // LETTERBOARD_H
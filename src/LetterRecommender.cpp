@@ -0,0 +1,104 @@
+// This file ranks the next letter to guess by the information it is expected to reveal
+
+#include "LetterRecommender.h"
+#include "Parallel.h"
+#include "PhraseBoard.h"
+#include "PhraseLibrary.h"
+
+#include <QtAlgorithms>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+using LetterSplits = std::array<std::unordered_map<std::uint64_t, std::uint32_t>, 26>;
+
+bool LetterRecommender::isVowel(char letter) {
+    return letter == 'A' || letter == 'E' || letter == 'I' || letter == 'O' || letter == 'U';
+}
+
+// Identifies one hidden cell within the set of cells a letter would reveal. The first 64
+// cells get a bit of their own, longer phrases fall back to hashing the cell number.
+static std::uint64_t cellKey(std::size_t cell) {
+    if (cell < 64)
+        return std::uint64_t(1) << cell;
+
+    std::uint64_t value = cell + 0x9E3779B97F4A7C15ull;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+    return value ^ (value >> 31);
+}
+
+LetterAdvice LetterRecommender::recommend(const PhraseLibrary &library, const PhraseBoard &board,
+                                          int categoryId, unsigned threads) {
+    LetterAdvice advice;
+    const PhraseSolver::Candidates candidates = library.solver().candidates(board, categoryId);
+    const std::size_t count = candidates.ids.size();
+    const std::size_t width = candidates.hiddenCells;
+    advice.candidates = count;
+
+    // For every letter, how many candidates reveal it in each set of cells. Each chunk of
+    // candidates is counted on its own and merged at the end.
+    LetterSplits splits;
+    std::mutex mergeLock;
+    parallelFor(count, [&](std::size_t begin, std::size_t end) {
+        LetterSplits local;
+        for (std::size_t row = begin; row < end; row++) {
+            std::array<std::uint64_t, 26> keys{};
+            std::uint32_t present = 0;
+            const std::uint8_t *letters = candidates.letters.data() + row * width;
+            for (std::size_t cell = 0; cell < width; cell++) {
+                keys[letters[cell]] ^= cellKey(cell);
+                present |= 1u << letters[cell];
+            }
+            for (; present; present &= present - 1) {
+                const int letter = qCountTrailingZeroBits(present);
+                local[letter][keys[letter]]++;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mergeLock);
+        for (int letter = 0; letter < 26; letter++) {
+            for (const auto &split : local[letter])
+                splits[letter][split.first] += split.second;
+        }
+    }, threads);
+
+    for (int letter = 0; letter < 26; letter++) {
+        LetterScore score;
+        score.letter = static_cast<char>('A' + letter);
+        if (board.isGuessed(score.letter))
+            continue;
+
+        if (count > 0) {
+            // Candidates without the letter form one more group of the split
+            std::size_t containing = 0;
+            for (const auto &split : splits[letter]) {
+                const double share = double(split.second) / double(count);
+                score.information -= share * std::log2(share);
+                containing += split.second;
+            }
+            if (containing < count) {
+                const double share = double(count - containing) / double(count);
+                score.information -= share * std::log2(share);
+            }
+            score.probability = double(containing) / double(count);
+        }
+
+        (isVowel(score.letter) ? advice.vowels : advice.consonants).push_back(score);
+    }
+
+    const auto better = [](const LetterScore &a, const LetterScore &b) {
+        if (a.information != b.information)
+            return a.information > b.information;
+        if (a.probability != b.probability)
+            return a.probability > b.probability;
+        return a.letter < b.letter;
+    };
+    std::sort(advice.vowels.begin(), advice.vowels.end(), better);
+    std::sort(advice.consonants.begin(), advice.consonants.end(), better);
+    return advice;
+}
@@ -0,0 +1,35 @@
+#ifndef LETTERRECOMMENDER_H
+#define LETTERRECOMMENDER_H
+
+#include <cstddef>
+#include <vector>
+
+class PhraseBoard;
+class PhraseLibrary;
+
+struct LetterScore {
+    char letter = 'A';
+    double information = 0.0;  // expected bits learned by guessing it, see LetterRecommender
+    double probability = 0.0;  // share of the candidate phrases containing it
+};
+
+struct LetterAdvice {
+    std::size_t candidates = 0;            // phrases still consistent with the board
+    std::vector<LetterScore> vowels;       // unguessed vowels, best first (bought with gems)
+    std::vector<LetterScore> consonants;   // unguessed consonants, best first (guessed after a spin)
+};
+
+// Ranks the letters that have not been guessed yet by how much guessing them would narrow
+// down the phrases still consistent with the board. Guessing a letter splits the candidates
+// by where the letter shows up (or that it is absent); the expected information is the
+// entropy of that split, so a letter that separates the candidates into many small groups
+// ranks first. Candidates are evaluated in parallel across all cores.
+class LetterRecommender {
+public:
+    static LetterAdvice recommend(const PhraseLibrary &library, const PhraseBoard &board,
+                                  int categoryId = -1, unsigned threads = 0);
+
+    static bool isVowel(char letter);
+};
+
+#endif // LETTERRECOMMENDER_H
@@ -1,6 +1,7 @@
 // This file handles the main menu and navigation for the Spin & Solve game
 
 #include "MainController.h"
+#include "AssetManager.h"
 #include "Difficulty.h"
 #include "GameController.h"
 #include "Instructions.h"
@@ -8,7 +9,6 @@
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QLabel>
-#include <QPixmap>
 #include <QPushButton>
 #include <QMessageBox>
 #include <QDebug>
@@ -20,8 +20,7 @@ MainController::MainController(QWidget *parent) : QWidget(parent) {
 
     // Background image using QLabel
     QLabel *background = new QLabel(this);
-    QPixmap pix(":/images/images/SPIN_SOLVE.png");
-    background->setPixmap(pix.scaled(size(), Qt::IgnoreAspectRatio, Qt::SmoothTransformation));
+    background->setPixmap(AssetManager::pixmap(":/images/images/SPIN_SOLVE.png"));
     background->setGeometry(0, 0, width(), height());
     background->lower(); // send it behind all other widgets
 
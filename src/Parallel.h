@@ -0,0 +1,35 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+// Splits [0, count) into one contiguous chunk per core and runs body(begin, end) on each
+// chunk in its own thread. Returns once every chunk is done.
+template <typename Body>
+void parallelFor(std::size_t count, Body body, unsigned threads = 0) {
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    if (count < threads * 64)
+        threads = 1;  // not worth starting threads for tiny inputs
+
+    if (threads == 1) {
+        body(std::size_t(0), count);
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    const std::size_t chunk = (count + threads - 1) / threads;
+    for (unsigned t = 0; t < threads; t++) {
+        const std::size_t begin = std::min(count, t * chunk);
+        const std::size_t end = std::min(count, begin + chunk);
+        workers.emplace_back([&body, begin, end]() { body(begin, end); });
+    }
+    for (std::thread &worker : workers)
+        worker.join();
+}
+
+#endif // PARALLEL_H
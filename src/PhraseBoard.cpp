@@ -0,0 +1,104 @@
+// This file tracks which letters of a phrase have been revealed
+
+#include "PhraseBoard.h"
+
+static int letterIndex(char letter) {
+    if (letter >= 'a' && letter <= 'z')
+        return letter - 'a';
+    if (letter >= 'A' && letter <= 'Z')
+        return letter - 'A';
+    return -1;
+}
+
+std::uint32_t PhraseBoard::letterBit(char letter) {
+    const int index = letterIndex(letter);
+    return index < 0 ? 0 : std::uint32_t(1) << index;
+}
+
+PhraseBoard::PhraseBoard(std::string_view phrase)
+    : phrase(phrase)
+{
+    // Positions are stored as 16-bit offsets, longer text is cut off
+    if (this->phrase.size() > 0xFFFF)
+        this->phrase.resize(0xFFFF);
+
+    displayText.assign(this->phrase.size() * displayStride, ' ');
+    for (std::size_t i = 0; i < this->phrase.size(); i++)
+        displayText[i * displayStride] = this->phrase[i];
+
+    // Counting pass, then a prefix sum gives each letter its slice of the position table
+    std::array<std::uint16_t, 26> counts{};
+    for (char c : this->phrase) {
+        const int index = letterIndex(c);
+        if (index >= 0)
+            counts[index]++;
+    }
+
+    letterStart[0] = 0;
+    for (int i = 0; i < 26; i++) {
+        letterStart[i + 1] = static_cast<std::uint16_t>(letterStart[i] + counts[i]);
+        if (counts[i] > 0)
+            presentLetters |= std::uint32_t(1) << i;
+    }
+
+    positions.resize(letterStart[26]);
+    std::array<std::uint16_t, 26> fill{};
+    for (std::size_t i = 0; i < this->phrase.size(); i++) {
+        const int index = letterIndex(this->phrase[i]);
+        if (index < 0)
+            continue;
+        positions[letterStart[index] + fill[index]++] = static_cast<std::uint16_t>(i);
+        displayText[i * displayStride] = '_';
+    }
+
+    hiddenCells = letterStart[26];
+    markDirty(0, static_cast<int>(this->phrase.size()));
+}
+
+void PhraseBoard::markDirty(int begin, int end) {
+    if (dirty.isEmpty()) {
+        dirty.begin = begin;
+        dirty.end = end;
+    } else {
+        dirty.begin = begin < dirty.begin ? begin : dirty.begin;
+        dirty.end = end > dirty.end ? end : dirty.end;
+    }
+    displayRevision++;
+}
+
+int PhraseBoard::guess(char letter) {
+    const std::uint32_t bit = letterBit(letter);
+    if ((hiddenLetterMask() & bit) == 0) {
+        guessedLetters |= bit;
+        return 0;
+    }
+
+    guessedLetters |= bit;
+    const int index = letterIndex(letter);
+    for (int i = letterStart[index]; i < letterStart[index + 1]; i++)
+        displayText[static_cast<std::size_t>(positions[i]) * displayStride] = phrase[positions[i]];
+
+    // Positions are stored in ascending order, so the first and last bound the change
+    const int revealed = letterStart[index + 1] - letterStart[index];
+    hiddenCells -= revealed;
+    markDirty(positions[letterStart[index]], positions[letterStart[index + 1] - 1] + 1);
+    return revealed;
+}
+
+void PhraseBoard::revealAll() {
+    guessedLetters |= presentLetters;
+    if (hiddenCells == 0)
+        return;
+
+    for (std::size_t i = 0; i < phrase.size(); i++)
+        displayText[i * displayStride] = phrase[i];
+    hiddenCells = 0;
+    markDirty(0, static_cast<int>(phrase.size()));
+}
+
+int PhraseBoard::count(char letter) const {
+    const int index = letterIndex(letter);
+    if (index < 0)
+        return 0;
+    return letterStart[index + 1] - letterStart[index];
+}
@@ -0,0 +1,81 @@
+#ifndef PHRASEBOARD_H
+#define PHRASEBOARD_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Letter state of one phrase, independent of Qt so bots and the simulator can use it directly.
+// The positions of every letter and a mask of the letters present are computed once, so a
+// guess is a mask test plus a write of the precomputed positions, and completion is a counter
+// check. Letters are A-Z (case-insensitive); every other character is shown from the start.
+//
+// The board also keeps the text the player sees, preformatted with a fixed stride of three
+// characters per cell ("A  ", "_  ", and three spaces between words). Reveals patch their cells
+// in place and bump the revision, and the dirty range tells the UI which cells changed.
+class PhraseBoard {
+public:
+    static constexpr int displayStride = 3;
+
+    // Cells [begin, end) changed since the dirty range was last cleared, empty if begin == end
+    struct DirtyRange {
+        int begin = 0;
+        int end = 0;
+        bool isEmpty() const { return begin >= end; }
+    };
+
+    PhraseBoard() = default;
+    explicit PhraseBoard(std::string_view phrase);
+
+    // Reveals a letter, returns how many cells it uncovered (0 if it is not in the phrase
+    // or was guessed before)
+    int guess(char letter);
+    void revealAll();
+
+    // Bit i stands for the letter 'A' + i
+    static std::uint32_t letterBit(char letter);
+
+    bool contains(char letter) const { return (presentLetters & letterBit(letter)) != 0; }
+    bool isGuessed(char letter) const { return (guessedLetters & letterBit(letter)) != 0; }
+    std::uint32_t letterMask() const { return presentLetters; }
+    std::uint32_t guessedMask() const { return guessedLetters; }
+    std::uint32_t hiddenLetterMask() const { return presentLetters & ~guessedLetters; }
+
+    // Number of cells holding letter (0 if it is absent)
+    int count(char letter) const;
+
+    bool isComplete() const { return hiddenCells == 0; }
+    int hiddenCount() const { return hiddenCells; }
+    int length() const { return static_cast<int>(phrase.size()); }
+
+    const std::string &text() const { return phrase; }
+
+    // What the player sees in a cell, '_' for a hidden letter
+    char cell(int position) const { return displayText[static_cast<std::size_t>(position) * displayStride]; }
+
+    // The formatted phrase, cell i starts at i * displayStride
+    const std::string &display() const { return displayText; }
+    std::uint64_t revision() const { return displayRevision; }
+    DirtyRange dirtyRange() const { return dirty; }
+    void clearDirty() { dirty = DirtyRange(); }
+
+private:
+    void markDirty(int begin, int end);
+
+    std::string phrase;
+    std::string displayText;
+    std::uint64_t displayRevision = 0;
+    DirtyRange dirty;
+
+    // Positions of each letter, back to back: letter i owns [letterStart[i], letterStart[i + 1])
+    std::array<std::uint16_t, 27> letterStart{};
+    std::vector<std::uint16_t> positions;
+
+    std::uint32_t presentLetters = 0;
+    std::uint32_t guessedLetters = 0;
+    int hiddenCells = 0;
+};
+
+#endif // PHRASEBOARD_H
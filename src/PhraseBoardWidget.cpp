@@ -0,0 +1,262 @@
+// This file draws the phrase of the game screen as letter tiles
+
+#include "PhraseBoardWidget.h"
+
+#include <QFont>
+#include <QPaintEvent>
+#include <QPainter>
+
+#include <algorithm>
+#include <cmath>
+
+static bool isLetter(char c) {
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+}
+
+PhraseBoardWidget::PhraseBoardWidget(QWidget *parent)
+    : QWidget(parent)
+{
+    setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Fixed);
+    setFixedHeight(maxRows * (maxTile + maxTile / 8));
+
+    frameTimer.setInterval(16);
+    frameTimer.setTimerType(Qt::PreciseTimer);
+    connect(&frameTimer, &QTimer::timeout, this, &PhraseBoardWidget::animate);
+}
+
+QSize PhraseBoardWidget::sizeHint() const {
+    return QSize(700, maxRows * (maxTile + maxTile / 8));
+}
+
+void PhraseBoardWidget::setBoard(const PhraseBoard &newBoard) {
+    board = &newBoard;
+    shown.resize(static_cast<std::size_t>(board->length()));
+    for (int i = 0; i < board->length(); i++)
+        shown[static_cast<std::size_t>(i)] = board->cell(i);
+
+    flips.clear();
+    frameTimer.stop();
+    atlasTile = 0;  // the new phrase may have other characters
+
+    layoutTiles();
+    update();
+}
+
+void PhraseBoardWidget::reveal(int begin, int end) {
+    if (!board)
+        return;
+
+    if (!animationClock.isValid())
+        animationClock.start();
+    const qint64 now = animationClock.elapsed();
+
+    begin = std::max(begin, 0);
+    end = std::min(end, board->length());
+
+    // Tiles revealed together flip one after the other, a whole board within maxStaggerMillis
+    int changed = 0;
+    for (int i = begin; i < end; i++) {
+        if (board->cell(i) != shown[static_cast<std::size_t>(i)])
+            changed++;
+    }
+    const qint64 stagger = changed > 0 ? std::min(staggerMillis, maxStaggerMillis / changed) : 0;
+
+    int order = 0;
+    for (int i = begin; i < end; i++) {
+        const char c = board->cell(i);
+        if (c == shown[static_cast<std::size_t>(i)])
+            continue;
+
+        shown[static_cast<std::size_t>(i)] = c;
+        if (tiles[static_cast<std::size_t>(i)].isEmpty())
+            continue;
+
+        flips.push_back(Flip{ i, now + order++ * stagger });
+        update(tiles[static_cast<std::size_t>(i)]);
+    }
+
+    if (!flips.empty() && !frameTimer.isActive())
+        frameTimer.start();
+}
+
+// Wraps the phrase into rows of square tiles of the given size: words move to the next row as
+// a whole unless a single word is wider than the widget. Returns the number of rows; if tiles
+// is given, it gets the position of every tile, with each row centred.
+int PhraseBoardWidget::wrap(int tile, std::vector<QRect> *placed) const {
+    const std::string &text = board->text();
+    const int step = tile + tile / 8;
+    const int space = tile / 2;
+
+    std::vector<int> rowOf(text.size(), 0);
+    std::vector<int> xOf(text.size(), 0);
+    std::vector<int> rowWidth(1, 0);
+    int row = 0;
+    int x = 0;
+
+    std::size_t i = 0;
+    while (i < text.size()) {
+        if (text[i] == ' ') {
+            i++;
+            continue;
+        }
+        std::size_t wordEnd = text.find(' ', i);
+        if (wordEnd == std::string::npos)
+            wordEnd = text.size();
+
+        const int wordWidth = static_cast<int>(wordEnd - i) * step - tile / 8;
+        if (x > 0 && x + space + wordWidth > width()) {
+            row++;
+            x = 0;
+            rowWidth.push_back(0);
+        } else if (x > 0) {
+            x += space;
+        }
+
+        for (; i < wordEnd; i++) {
+            if (x > 0 && x + tile > width()) {
+                row++;
+                x = 0;
+                rowWidth.push_back(0);
+            }
+            rowOf[i] = row;
+            xOf[i] = x;
+            rowWidth[static_cast<std::size_t>(row)] = x + tile;
+            x += step;
+        }
+    }
+
+    if (placed) {
+        const int top = (height() - (row + 1) * step + tile / 8) / 2;
+        for (std::size_t cell = 0; cell < text.size(); cell++) {
+            if (text[cell] == ' ')
+                continue;
+            const int left = (width() - rowWidth[static_cast<std::size_t>(rowOf[cell])]) / 2;
+            (*placed)[cell] = QRect(left + xOf[cell], top + rowOf[cell] * step, tile, tile);
+        }
+    }
+    return row + 1;
+}
+
+void PhraseBoardWidget::layoutTiles() {
+    tiles.assign(board ? static_cast<std::size_t>(board->length()) : 0, QRect());
+    if (!board || width() <= 0)
+        return;
+
+    // Largest tile size that fits in the rows
+    tileSize = minTile;
+    for (int tile = maxTile; tile > minTile; tile--) {
+        if (wrap(tile, nullptr) <= maxRows) {
+            tileSize = tile;
+            break;
+        }
+    }
+    wrap(tileSize, &tiles);
+
+    if (atlasTile != tileSize || atlasRatio != devicePixelRatioF())
+        buildAtlas();
+}
+
+// Renders the hidden tile and one tile per character of the phrase, in device pixels
+void PhraseBoardWidget::buildAtlas() {
+    atlasIndex.fill(-1);
+    std::string glyphs;
+    for (char c : board->text()) {
+        const unsigned char key = static_cast<unsigned char>(isLetter(c) ? c & ~0x20 : c);
+        if (c != ' ' && atlasIndex[key] < 0) {
+            atlasIndex[key] = static_cast<int>(glyphs.size()) + 1;
+            glyphs.push_back(static_cast<char>(key));
+        }
+    }
+
+    atlasTile = tileSize;
+    atlasRatio = devicePixelRatioF();
+    atlas = QPixmap(qRound((glyphs.size() + 1) * tileSize * atlasRatio), qRound(tileSize * atlasRatio));
+    atlas.setDevicePixelRatio(atlasRatio);
+    atlas.fill(Qt::transparent);
+
+    QPainter painter(&atlas);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setRenderHint(QPainter::TextAntialiasing);
+
+    QFont font("Verdana");
+    font.setBold(true);
+    font.setPixelSize(tileSize * 3 / 5);
+    painter.setFont(font);
+
+    const qreal radius = tileSize / 8.0;
+    const QRectF first(0.5, 0.5, tileSize - 1.0, tileSize - 1.0);
+
+    painter.setPen(QPen(QColor("#5C1F53"), 2));
+    painter.setBrush(QColor("#8F0774"));
+    painter.drawRoundedRect(first, radius, radius);
+
+    for (std::size_t slot = 0; slot < glyphs.size(); slot++) {
+        const char c = glyphs[slot];
+        const QRectF tile = first.translated((slot + 1) * tileSize, 0);
+        if (isLetter(c)) {
+            painter.setPen(QPen(QColor("#5C1F53"), 2));
+            painter.setBrush(QColor("#FFE3F8"));
+            painter.drawRoundedRect(tile, radius, radius);
+        }
+        painter.setPen(QColor("#5C1F53"));
+        painter.drawText(tile, Qt::AlignCenter, QString(QChar::fromLatin1(c)));
+    }
+}
+
+QRect PhraseBoardWidget::atlasSlot(char c) const {
+    int slot = 0;
+    if (c != '_') {
+        const unsigned char key = static_cast<unsigned char>(isLetter(c) ? c & ~0x20 : c);
+        slot = std::max(atlasIndex[key], 0);
+    }
+    return QRect(qRound(slot * tileSize * atlasRatio), 0, qRound(tileSize * atlasRatio), qRound(tileSize * atlasRatio));
+}
+
+// Repaints the flipping tiles and retires the ones that finished
+void PhraseBoardWidget::animate() {
+    const qint64 now = animationClock.elapsed();
+    for (const Flip &flip : flips)
+        update(tiles[static_cast<std::size_t>(flip.cell)]);
+
+    flips.erase(std::remove_if(flips.begin(), flips.end(),
+                               [now](const Flip &flip) { return now - flip.start > flipMillis; }),
+                flips.end());
+    if (flips.empty())
+        frameTimer.stop();
+}
+
+void PhraseBoardWidget::paintEvent(QPaintEvent *event) {
+    if (!board || tiles.empty())
+        return;
+
+    QPainter painter(this);
+    const QRegion &dirty = event->region();
+    const qint64 now = animationClock.isValid() ? animationClock.elapsed() : 0;
+
+    for (std::size_t cell = 0; cell < tiles.size(); cell++) {
+        const QRect &tile = tiles[cell];
+        if (tile.isEmpty() || !dirty.intersects(tile))
+            continue;
+
+        char c = shown[cell];
+        QRect target = tile;
+
+        // A flip shrinks the hidden tile to a line and grows the letter out of it
+        const auto flip = std::find_if(flips.begin(), flips.end(),
+                                       [cell](const Flip &f) { return f.cell == static_cast<int>(cell); });
+        if (flip != flips.end()) {
+            const double t = std::clamp((now - flip->start) / double(flipMillis), 0.0, 1.0);
+            if (t < 0.5)
+                c = '_';
+            const int height = std::max(1, qRound(tile.height() * std::abs(1.0 - 2.0 * t)));
+            target = QRect(tile.left(), tile.center().y() - height / 2, tile.width(), height);
+        }
+
+        painter.drawPixmap(target, atlas, atlasSlot(c));
+    }
+}
+
+void PhraseBoardWidget::resizeEvent(QResizeEvent *event) {
+    QWidget::resizeEvent(event);
+    layoutTiles();
+}
@@ -0,0 +1,76 @@
+#ifndef PHRASEBOARDWIDGET_H
+#define PHRASEBOARDWIDGET_H
+
+#include "PhraseBoard.h"
+
+#include <QElapsedTimer>
+#include <QPixmap>
+#include <QRect>
+#include <QTimer>
+#include <QWidget>
+
+#include <array>
+#include <string>
+#include <vector>
+
+// Draws a PhraseBoard as letter tiles. The tiles are laid out once per phrase (and again only
+// if the width changes): words wrap as a whole and the tile size shrinks until the phrase fits
+// in maxRows rows. Every tile the phrase can show is rendered once into a glyph atlas at the
+// screen's pixel ratio, so painting a tile is a single pixmap copy. A reveal repaints only the
+// tiles it changed, each flipping over from hidden to its letter.
+class PhraseBoardWidget : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit PhraseBoardWidget(QWidget *parent = nullptr);
+
+    // Shows a new phrase as it stands, without animating. The board must outlive the widget or
+    // the next setBoard call.
+    void setBoard(const PhraseBoard &board);
+
+    // Flips the tiles of cells [begin, end) that changed on the board, e.g. from
+    // GameSession::takeDirtyRange()
+    void reveal(int begin, int end);
+
+    QSize sizeHint() const override;
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
+
+private:
+    static constexpr int maxRows = 2;
+    static constexpr int maxTile = 36;
+    static constexpr int minTile = 16;
+    static constexpr int flipMillis = 260;
+    static constexpr int staggerMillis = 70;  // between tiles revealed together
+    static constexpr int maxStaggerMillis = 700;
+
+    struct Flip {
+        int cell;
+        qint64 start;  // on animationClock
+    };
+
+    void layoutTiles();
+    int wrap(int tile, std::vector<QRect> *placed) const;
+    void buildAtlas();
+    QRect atlasSlot(char c) const;
+    void animate();
+
+    const PhraseBoard *board = nullptr;
+    std::string shown;              // what each tile currently shows, as PhraseBoard::cell
+    std::vector<QRect> tiles;       // per cell, empty for spaces
+    int tileSize = 0;
+
+    // Slot 0 is the hidden tile, then one per character of the phrase
+    QPixmap atlas;
+    std::array<int, 256> atlasIndex{};
+    int atlasTile = 0;
+    qreal atlasRatio = 0.0;
+
+    std::vector<Flip> flips;
+    QElapsedTimer animationClock;
+    QTimer frameTimer;
+};
+
+#endif // PHRASEBOARDWIDGET_H
@@ -0,0 +1,33 @@
+// This file saves and restores the per-player phrase history so phrases do not repeat across sessions
+
+#include "PhraseHistory.h"
+
+PhraseHistory::PhraseHistory(const QString &player)
+    : settings("SpinAndSolve", "SpinAndSolve"), player(player)
+{
+}
+
+QString PhraseHistory::key(const QString &pool) const {
+    return "history/" + player + "/" + pool;
+}
+
+bool PhraseHistory::load(const QString &pool, std::uint64_t fingerprint, ScheduleState &state) const {
+    const QString base = key(pool);
+    if (!settings.contains(base + "/seed"))
+        return false;
+    if (settings.value(base + "/fingerprint").toULongLong() != fingerprint)
+        return false;
+
+    state.seed = settings.value(base + "/seed").toULongLong();
+    state.cursor = settings.value(base + "/cursor").toUInt();
+    state.poolSize = settings.value(base + "/poolSize").toUInt();
+    return true;
+}
+
+void PhraseHistory::save(const QString &pool, std::uint64_t fingerprint, const ScheduleState &state) {
+    const QString base = key(pool);
+    settings.setValue(base + "/fingerprint", QVariant::fromValue<quint64>(fingerprint));
+    settings.setValue(base + "/seed", QVariant::fromValue<quint64>(state.seed));
+    settings.setValue(base + "/cursor", state.cursor);
+    settings.setValue(base + "/poolSize", state.poolSize);
+}
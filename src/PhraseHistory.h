@@ -0,0 +1,26 @@
+#ifndef PHRASEHISTORY_H
+#define PHRASEHISTORY_H
+
+#include "PhraseScheduler.h"
+
+#include <QSettings>
+#include <QString>
+
+// Stores each player's shuffle-bag position between sessions, a few bytes per pool
+class PhraseHistory {
+public:
+    explicit PhraseHistory(const QString &player);
+
+    // A bag saved for other phrases (see PhraseLibrary::fingerprint) is not loaded, so an
+    // edited pack starts a fresh bag
+    bool load(const QString &pool, std::uint64_t fingerprint, ScheduleState &state) const;
+    void save(const QString &pool, std::uint64_t fingerprint, const ScheduleState &state);
+
+private:
+    QString key(const QString &pool) const;
+
+    mutable QSettings settings;
+    QString player;
+};
+
+#endif // PHRASEHISTORY_H
@@ -0,0 +1,201 @@
+// This file builds the per-attribute bitmaps used to select phrases matching a filter
+
+#include "PhraseIndex.h"
+#include "PhraseLibrary.h"
+
+#include <QtAlgorithms>
+
+#include <algorithm>
+#include <limits>
+
+bool PhraseQuery::operator==(const PhraseQuery &other) const {
+    return difficulty == other.difficulty
+        && category == other.category
+        && minLetters == other.minLetters
+        && maxLetters == other.maxLetters
+        && wordCount == other.wordCount
+        && minScore == other.minScore
+        && maxScore == other.maxScore
+        && requiredLetters == other.requiredLetters
+        && excludedLetters == other.excludedLetters;
+}
+
+bool PhraseQuery::difficultyOnly() const {
+    return category.empty() && minLetters <= 0 && maxLetters <= 0 && wordCount <= 0
+        && minScore <= 0.0f && maxScore <= 0.0f
+        && requiredLetters == 0 && excludedLetters == 0;
+}
+
+std::uint32_t PhraseQuery::letterMask(const std::string &letters) {
+    std::uint32_t mask = 0;
+    for (char c : letters) {
+        if (c >= 'a' && c <= 'z')
+            c = static_cast<char>(c - 'a' + 'A');
+        if (c >= 'A' && c <= 'Z')
+            mask |= 1u << (c - 'A');
+    }
+    return mask;
+}
+
+void PhraseIndex::set(Bitmap &bitmap, std::uint32_t id) const {
+    bitmap[id / 64] |= std::uint64_t(1) << (id % 64);
+}
+
+static int bandOf(float score) {
+    const int band = static_cast<int>(score / 10.0f);
+    return band < 0 ? 0 : band > 9 ? 9 : band;
+}
+
+void PhraseIndex::intersect(Bitmap &result, const Bitmap &other) {
+    for (std::size_t i = 0; i < result.size(); i++)
+        result[i] &= other[i];
+}
+
+// Computes the attributes of every phrase once and records them in the bitmaps
+void PhraseIndex::build(const PhraseLibrary &library) {
+    phraseCount = static_cast<std::uint32_t>(library.size());
+    words = (phraseCount + 63) / 64;
+
+    const Bitmap empty(words, 0);
+    tiers[0] = empty;
+    tiers[1] = empty;
+    this->library = &library;
+    categories.assign(static_cast<std::size_t>(library.categoryCount()), empty);
+    letterCounts.assign(maxLetterCount + 1, empty);
+    wordCounts.assign(maxWordCount + 1, empty);
+    for (Bitmap &bitmap : letters)
+        bitmap = empty;
+    exactLetterCounts.assign(phraseCount, 0);
+    exactWordCounts.assign(phraseCount, 0);
+
+    for (std::uint32_t id = 0; id < phraseCount; id++) {
+        const PhraseView phrase = library.phrase(static_cast<int>(id));
+
+        int letterCount = 0;
+        int wordCount = 0;
+        bool inWord = false;
+        std::uint32_t mask = 0;
+        for (char c : phrase.text) {
+            if (c >= 'A' && c <= 'Z') {
+                letterCount++;
+                mask |= 1u << (c - 'A');
+            }
+            if (c == ' ') {
+                inWord = false;
+            } else if (!inWord) {
+                inWord = true;
+                wordCount++;
+            }
+        }
+
+        exactLetterCounts[id] = static_cast<std::uint16_t>(std::min(letterCount, 0xFFFF));
+        exactWordCounts[id] = static_cast<std::uint16_t>(std::min(wordCount, 0xFFFF));
+
+        set(tiers[library.difficultyOf(static_cast<int>(id))], id);
+        set(letterCounts[letterCount < maxLetterCount ? letterCount : maxLetterCount], id);
+        set(wordCounts[wordCount < maxWordCount ? wordCount : maxWordCount], id);
+        for (int letter = 0; letter < 26; letter++) {
+            if (mask & (1u << letter))
+                set(letters[letter], id);
+        }
+
+        if (phrase.categoryId >= 0 && phrase.categoryId < static_cast<int>(categories.size()))
+            set(categories[phrase.categoryId], id);
+    }
+
+    if (library.scoredDifficulty())
+        scoreBands();
+}
+
+const std::vector<PhraseIndex::Bitmap> &PhraseIndex::scoreBands() const {
+    std::call_once(bandsBuilt, [this]() {
+        const std::vector<float> &scores = library->scores();
+        bands.assign(bandCount, Bitmap(words, 0));
+        for (std::uint32_t id = 0; id < phraseCount; id++)
+            set(bands[bandOf(scores[id])], id);
+    });
+    return bands;
+}
+
+// Intersects the bitmaps of every constraint in the query and lists the surviving ids
+std::vector<std::uint32_t> PhraseIndex::match(const PhraseQuery &query) const {
+    Bitmap result(words, ~std::uint64_t(0));
+    if (phraseCount % 64 != 0)
+        result.back() = (std::uint64_t(1) << (phraseCount % 64)) - 1;
+
+    if (query.difficulty == 0 || query.difficulty == 1)
+        intersect(result, tiers[query.difficulty]);
+
+    if (!query.category.empty()) {
+        const int category = library ? library->findCategory(query.category) : -1;
+        if (category < 0)
+            return {};
+        intersect(result, categories[category]);
+    }
+
+    // Counts past the last bucket share it, the exact bounds are then checked on the survivors
+    const int minLetters = query.minLetters > 0 ? query.minLetters : 0;
+    const int maxLetters = query.maxLetters > 0 ? query.maxLetters : std::numeric_limits<int>::max();
+    bool exactLetters = false;
+    if (query.minLetters > 0 || query.maxLetters > 0) {
+        if (minLetters > maxLetters)
+            return {};
+        const int low = std::min(minLetters, maxLetterCount);
+        const int high = std::min(maxLetters, maxLetterCount);
+        exactLetters = high == maxLetterCount;
+
+        Bitmap range(words, 0);
+        for (int count = low; count <= high; count++) {
+            for (std::size_t i = 0; i < words; i++)
+                range[i] |= letterCounts[count][i];
+        }
+        intersect(result, range);
+    }
+
+    const bool exactWords = query.wordCount >= maxWordCount;
+    if (query.wordCount > 0)
+        intersect(result, wordCounts[std::min(query.wordCount, maxWordCount)]);
+
+    // Whole score bands narrow the result, the exact bounds are checked on the survivors
+    const bool scoreRange = query.minScore > 0.0f || query.maxScore > 0.0f;
+    const std::vector<float> *scores = scoreRange ? &library->scores() : nullptr;
+    if (scoreRange) {
+        const int low = bandOf(query.minScore);
+        const int high = query.maxScore > 0.0f ? bandOf(query.maxScore) : bandCount - 1;
+        const std::vector<Bitmap> &bandBitmaps = scoreBands();
+
+        Bitmap range(words, 0);
+        for (int band = low; band <= high; band++) {
+            for (std::size_t i = 0; i < words; i++)
+                range[i] |= bandBitmaps[band][i];
+        }
+        intersect(result, range);
+    }
+
+    for (int letter = 0; letter < 26; letter++) {
+        if (query.requiredLetters & (1u << letter))
+            intersect(result, letters[letter]);
+        if (query.excludedLetters & (1u << letter)) {
+            for (std::size_t i = 0; i < words; i++)
+                result[i] &= ~letters[letter][i];
+        }
+    }
+
+    std::vector<std::uint32_t> ids;
+    for (std::size_t i = 0; i < words; i++) {
+        std::uint64_t bits = result[i];
+        while (bits) {
+            const std::uint32_t id = static_cast<std::uint32_t>(i * 64 + qCountTrailingZeroBits(bits));
+            bits &= bits - 1;
+
+            if (scores && ((*scores)[id] < query.minScore || (query.maxScore > 0.0f && (*scores)[id] >= query.maxScore)))
+                continue;
+            if (exactLetters && (exactLetterCounts[id] < minLetters || exactLetterCounts[id] > maxLetters))
+                continue;
+            if (exactWords && exactWordCounts[id] != query.wordCount)
+                continue;
+            ids.push_back(id);
+        }
+    }
+    return ids;
+}
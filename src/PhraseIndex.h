@@ -0,0 +1,71 @@
+#ifndef PHRASEINDEX_H
+#define PHRASEINDEX_H
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class PhraseLibrary;
+
+// Filter for selecting phrases, every field left at its default matches everything
+struct PhraseQuery {
+    int difficulty = -1;                // 0 = easy, 1 = hard
+    std::string category;               // exact category name, e.g. "Movie Title"
+    int minLetters = 0;                 // letter count range (spaces and punctuation not counted)
+    int maxLetters = 0;
+    int wordCount = 0;
+    float minScore = 0.0f;              // difficulty score range [minScore, maxScore), see PhraseScorer
+    float maxScore = 0.0f;              // 0 = no upper bound
+    std::uint32_t requiredLetters = 0;  // bit 0 = 'A' ... bit 25 = 'Z', all must appear
+    std::uint32_t excludedLetters = 0;  // none of these may appear
+
+    bool operator==(const PhraseQuery &other) const;
+    bool operator!=(const PhraseQuery &other) const { return !(*this == other); }
+
+    // True when only the difficulty is constrained, those phrases form one contiguous id range
+    bool difficultyOnly() const;
+
+    // Bit mask for a set of letters, e.g. letterMask("XYZ")
+    static std::uint32_t letterMask(const std::string &letters);
+};
+
+// Per-attribute bitmaps over every phrase in a library, built once.
+// A query is answered by AND-ing the bitmaps of its constraints, never by scanning phrase text.
+class PhraseIndex {
+public:
+    void build(const PhraseLibrary &library);
+
+    // Ids of all phrases matching the query, in ascending order
+    std::vector<std::uint32_t> match(const PhraseQuery &query) const;
+
+private:
+    using Bitmap = std::vector<std::uint64_t>;
+
+    static const int maxLetterCount = 63;  // longer phrases share the last bucket, their exact
+    static const int maxWordCount = 15;    // counts are checked on the survivors
+    static const int bandCount = 10;       // bands of 10 score points
+
+    void set(Bitmap &bitmap, std::uint32_t id) const;
+    const std::vector<Bitmap> &scoreBands() const;
+    static void intersect(Bitmap &result, const Bitmap &other);
+
+    std::uint32_t phraseCount = 0;
+    std::size_t words = 0;  // 64-bit words per bitmap
+
+    Bitmap tiers[2];
+    std::vector<Bitmap> categories;  // by category id
+    const PhraseLibrary *library = nullptr;
+    std::vector<Bitmap> letterCounts;
+    std::vector<Bitmap> wordCounts;
+
+    // Scoring reads the whole corpus twice, so the bands are only built for a scored library
+    // or the first query with a score range
+    mutable std::once_flag bandsBuilt;
+    mutable std::vector<Bitmap> bands;
+    Bitmap letters[26];  // scores are read from the library
+    std::vector<std::uint16_t> exactLetterCounts;  // by id, only read for the last buckets
+    std::vector<std::uint16_t> exactWordCounts;
+};
+
+#endif // PHRASEINDEX_H
@@ -1,227 +1,485 @@
 // File includes the lists of phrases and their corresponding hints for each category and difficulty level
 
 #include "PhraseLibrary.h"
-#include <cstdlib>
-#include <ctime>
-
-PhraseLibrary::PhraseLibrary() : lastEasyIndex(-1), lastHardIndex(-1) {
-    std::srand(std::time(nullptr));
-
-    // EASY PHRASES
-    easyPhrase = {
-        // FOOD
-        {"CHOCOLATE CAKE", "Food", {"Sweet dessert", "Made from cocoa", "Popular birthday treat"}},
-        {"APPLE PIE", "Food", {"Classic Fall dessert", "Often served with ice cream", "Made with fruit filling"}},
-        {"PEPPERONI PIZZA", "Food", {"Italian dish", "Often round in shape", "Baked in oven"}},
-        {"MAC AND CHEESE", "Food", {"Cheesy comfort food", "Pasta dish", "Can be baked"}},
-        {"STRAWBERRY JAM", "Food", {"Spreadable fruit", "Made from berries", "Sweet taste"}},
-        {"CHOCOLATE CHIP COOKIE", "Food", {"Baked treat", "Has chocolate chunks", "Often a circular shape"}},
-        {"FRUIT SALAD", "Food", {"Mix of fruits", "Healthy option", "Often served chilled"}},
-
-        // ANIMAL
-        {"POLAR BEAR", "Animal", {"Arctic animal", "White fur", "Largest land carnivore"}},
-        {"ORANGE CAT", "Animal", {"Domestic pet", "Cartoon charcater Garfield", "Often orange colored"}},
-        {"BLUE WHALE", "Animal", {"Largest animal on Earth", "Lives in ocean", "Makes loud sounds"}},
-        {"GRAY WOLF", "Animal", {"Lives in packs", "Gray fur", "Carnivorous mammal"}},
-        {"SEA TURTLE", "Animal", {"Marine reptile", "Lives in ocean", "Can live long"}},
-        {"GOLDEN RETRIEVER", "Animal", {"Friendly dog breed", "Golden fur", "Good family pet"}},
-
-        // MOVIE TITLE
-        {"TOY STORY", "Movie Title", {"Animated movie", "Buzz and Woody", "Toys come to life"}},
-        {"JURASSIC PARK", "Movie Title", {"Dinosaurs", "Adventure film", "Directed by Spielberg"}},
-        {"HARRY POTTER", "Movie Title", {"Wizard story", "Magic school", "Famous books adaptation"}},
-        {"TANGLED", "Movie Title", {"Story about long hair", "Disney animation", "Rapunzel"}},
-        {"THE LION KING", "Movie Title", {"Disney classic", "Lion protagonist", "Africa setting"}},
-        {"FINDING NEMO", "Movie Title", {"Clownfish", "Ocean adventure", "Father searches for son"}},
-        {"MONSTERS INC", "Movie Title", {"One eyed monster", "Funny monsters", "Pixar animation"}},
-        {"THE LITTLE MERMAID", "Movie Title", {"Mermaid protagonist", "Main character wants to be human", "Underwater story"}},
-
-        // SONG TITLE
-        {"SHAKE IT OFF", "Song Title", {"Taylor Swift hit", "Pop genre", "About ignoring critics"}},
-        {"COUNTING STARS", "Song Title", {"OneRepublic hit", "Pop-rock genre", "About dreams and money"}},
-        {"SHAPE OF YOU", "Song Title", {"Ed Sheeran hit", "Pop song", "Danceable tune"}},
-        {"FIREWORK", "Song Title", {"Katy Perry song", "Inspirational lyrics", "Pop genre"}},
-        {"LET IT GO", "Song Title", {"Frozen movie song", "Disney", "Powerful female vocals"}},
-        {"BLANK SPACE", "Song Title", {"Taylor Swift", "Pop hit", "Satirical love song"}},
-        {"HEY BROTHER", "Song Title", {"Avicii song", "Electronic music", "Family-themed lyrics"}},
-        {"DON'T YOU WORRY CHILD", "Song Title", {"Swedish House Mafia", "EDM hit", "Emotional lyrics"}},
-        {"UNDER CONTROL", "Song Title", {"Calvin Harris", "EDM track", "Upbeat dance song"}},
-        {"MIRACLE MAKER", "Song Title", {"By Dom Dolla", "House music genre", "Uplifting lyrics"}},
-        {"HAVANA", "Song Title", {"Camila Cabello", "Cuban influence", "Pop hit"}},
-        {"FEEL SO CLOSE", "Song Title", {"Calvin Harris track", "Dance song", "Electronic music"}},
-        {"HEADLINES", "Song Title", {"Drake song", "Hip-hop", "Catchy lyrics"}},
-        {"DIE YOUNG", "Song Title", {"Ke$ha hit", "Party song", "Upbeat tempo"}},
-        {"AM I WRONG", "Song Title", {"Nico & Vinz", "Pop song", "Motivational lyrics"}},
-        {"RHYTHM AS A DANCER", "Song Title", {"Snap!", "80s hit", "Dance song"}},
-        {"TELEPHONE", "Song Title", {"Lady Gaga", "Pop hit", "Collab with Beyoncé"}},
-        {"LEAN ON ME", "Song Title", {"Church Song", "Inspirational", "Helping friends"}},
-        {"LEAN ON", "Song Title", {"Major Lazer", "Electronic", "Collaborative track"}},
-
-        // COUNTRIES
-        {"ITALY", "Country", {"Famous for pasta", "Rome is the capital", "Home of the Colosseum"}},
-        {"POLAND", "Country", {"Eastern Europe", "Warsaw capital", "Famous for pierogi"}},
-        {"SOUTH KOREA", "Country", {"Capital is Seoul", "K-pop music", "Technologically advanced"}},
-        {"GREECE", "Country", {"Olympic origins", "Athens capital", "Famous islands"}},
-        {"SWITZERLAND", "Country", {"Neutral country", "Alps mountains", "Famous for chocolate"}},
-        {"AUSTRALIA", "Country", {"Sydney Opera House", "Kangaroos", "Southern hemisphere"}},
-
-        // PLACE
-        {"AMUSEMENT PARK", "Place", {"Roller coasters", "Fun rides", "Often has cotton candy"}},
-        {"THE ZOO", "Place", {"Animals to see", "Educational trips", "Often for families"}},
-        {"THE BEACH", "Place", {"Sand and water", "Sunbathing", "Swimming activities"}},
-        {"MOVIE THEATER", "Place", {"Big screen", "Popcorn snacks", "Watch films"}},
-        {"COFFEE SHOP", "Place", {"Hot beverages", "Relaxing spot", "Often Wi-Fi available"}},
-        {"WESTERN UNIVERSITY", "Place", {"Educational institution", "Ontario location", "Campus life"}},
-        {"TRAMPOLINE PARK", "Place", {"Jumping activity", "Indoor fun", "Exercise and play"}},
-
-        // QUOTATION
-        {"PRACTICE MAKES PERFECT", "Quotation", {"Encourages repetition", "Learning advice", "Famous proverb"}},
-        {"BETTER LATE THAN NEVER", "Quotation", {"Timing advice", "Don't procrastinate", "Common saying"}},
-        {"KNOWLEDGE IS POWER", "Quotation", {"Famous saying", "Educational", "Importance of learning"}},
-        {"YOU ONLY LIVE ONCE", "Quotation", {"YOLO", "Live life fully", "Popular phrase"}},
-        {"HOME SWEET HOME", "Quotation", {"Comfort of home", "Family place", "Well-known proverb"}},
-        {"NEVER SAY NEVER", "Quotation", {"Motivational", "Persistence advice", "Popular saying"}},
-        {"THE EARLY BIRD GETS THE WORM", "Quotation", {"Wake up early", "Productivity advice", "Common proverb"}},
-        {"OUT OF SIGHT OUT OF MIND", "Quotation", {"Forget easily", "Not nearby", "What you don't know can't harm you"}},
-
-        // THING
-        {"RED BALLOON", "Thing", {"Round in shape", "Appears in the movie 'IT'", "Can float"}},
-        {"WATER BOTTLE", "Thing", {"Container for liquids", "Portable", "Reusable"}},
-        {"TEDDY BEAR", "Thing", {"Soft toy", "Resembles an animal", "Stuffed animal"}},
-        {"SUNGLASSES", "Thing", {"Protects eyes", "Worn outdoors", "Fashion accessory"}},
-        {"COMPUTER MOUSE", "Thing", {"Input device", "Connected to computer", "Hand-held"}},
-        {"PAINTBRUSH", "Thing", {"Used in painting", "Holds paint", "Art tool"}},
-        {"UMBRELLA", "Thing", {"Rain protection", "Portable", "Collapsible"}},
-        {"SKATEBOARD", "Thing", {"Rolling board", "Sporting activity", "Trick performance"}},
-        {"HEADPHONES", "Thing", {"Audio device", "Over ears or in ears", "Listen to music"}},
-        {"CANDLE", "Thing", {"Wax object", "Provides light", "Often scented"}},
-
-        // ARTISTS
-        {"JUSTIN BIEBER", "Artist", {"Pop singer", "Canadian", "Famous since 2009"}},
-        {"TAYLOR SWIFT", "Artist", {"Country and pop singer", "Known for her song 'Love Story'", "Engaged to an NFL Player"}},
-        {"KATY PERRY", "Artist", {"Pop singer", "Colorful performances", "California Dreams"}},
-        {"SELENA GOMEZ", "Artist", {"Pop singer", "Actress", "Disney Channel star"}},
-        {"ARIANA GRANDE", "Artist", {"Pop singer", "High vocal range", "Famous for ponytail"}},
-        {"BRUNO MARS", "Artist", {"Pop/R&B singer", "Performs live", "Hit songs"}},
-        {"ED SHEERAN", "Artist", {"Singer-songwriter", "Guitarist", "Hit song Shape of You"}}
-    };
-
-    // HARD PHRASES
-    hardPhrase = {
-        // FOOD
-        {"PAPIYA", "Food", {"Tropical fruit", "Sweet and juicy", "Often yellowish-orange"}},
-        {"POMMAGRANTE", "Food", {"Fruit with seeds", "Juicy red inside", "Used in salads"}},
-        {"ELDERBERRY", "Food", {"Dark berry", "Used in syrups", "Rich in antioxidants"}},
-        {"CHICKEN SOUVLAKI", "Food", {"Greek dish", "Grilled meat", "Served with pita"}},
-        {"BRUSCHETTA", "Food", {"Italian appetizer", "Toasted bread", "Topped with tomatoes"}},
-        {"CHARCUTERIE", "Food", {"Assortment of meats", "Served as appetizer", "French origin"}},
-        {"GNOCCHI", "Food", {"Italian pasta", "Potato-based", "Soft dumplings"}},
-        {"ESCARGOT", "Food", {"French cuisine", "Often served in garlic butter", "Edible snails"}},
-        {"MASCARPONE CHEESE", "Food", {"Italian cheese", "Used in desserts", "Soft and creamy"}},
-        {"BUCKWHEAT", "Food", {"Grain-like seed", "Used in pancakes", "Gluten-free option"}},
-        {"TIRAMISU", "Food", {"Italian dessert", "Coffee-flavored", "Layered with mascarpone"}},
-
-        // ANIMAL
-        {"HIPPOPOTAMUS", "Animal", {"Large African mammal", "Spends time in water", "Herbivore"}},
-        {"CATERPILLAR", "Animal", {"Larval stage", "Becomes butterfly", "Soft body"}},
-        {"ORANGUTAN", "Animal", {"Large ape", "Lives in trees", "Red fur"}},
-        {"CHIMPANZEE", "Animal", {"Intelligent ape", "Lives in Africa", "Uses tools"}},
-        {"RHINOCEROS", "Animal", {"Horned mammal", "Thick skin", "Large herbivore"}},
-        {"TASMANIAN DEVIL", "Animal", {"Australian marsupial", "Aggressive", "Black fur"}},
-        {"TARANTULA", "Animal", {"Large spider", "Hairy body", "Venomous bite"}},
-
-        // MOVIE TITLE
-        {"PIRATES OF THE CARIBBEAN", "Movie Title", {"Johnny Depp stars", "Jack Sparrow", "Pirates"}},
-        {"THE LORD OF THE RINGS", "Movie Title", {"Fantasy epic", "Frodo journey", "Based on Tolkien books"}},
-        {"THE CHRONICLES OF NARNIA", "Movie Title", {"Fantasy world", "Children enter wardrobe", "Magical creatures"}},
-        {"A STREETCAR NAMED DESIRE", "Movie Title", {"Classic play adaptation", "Tennessee Williams", "Drama"}},
-        {"HOW TO TRAIN YOUR DRAGON", "Movie Title", {"Animated film", "Viking boy", "Dragon companion"}},
-        {"THE SECRET LIFE OF PETS", "Movie Title", {"Animated comedy", "Pets' adventures", "City setting"}},
-        {"SPIDERMAN INTO THE SPIDERVERSE", "Movie Title", {"Multiple Spider-Men", "Animated film", "Superhero story"}},
-
-        // SONG TITLE
-        {"SMELLS LIKE TEEN SPIRIT", "Song Title", {"Nirvana song", "1990s grunge", "Famous guitar riff"}},
-        {"VIVA LA VIDA", "Song Title", {"Coldplay song", "Orchestral pop", "Historical references"}},
-        {"STAIRWAY TO HEAVEN", "Song Title", {"Led Zeppelin song", "Classic rock", "Epic guitar solo"}},
-        {"ANOTHER ONE BITES THE DUST", "Song Title", {"Queen song", "Funk rock", "Bass-driven track"}},
-        {"BOHEMIAN RHAPSODY", "Song Title", {"Queen hit", "Operatic sections", "Famous music video"}},
-        {"SINCE U BEEN GONE", "Song Title", {"Kelly Clarkson", "Pop-rock", "Breakup anthem"}},
-        {"SOMEBODY THAT I USED TO KNOW", "Song Title", {"Gotye song", "Duet", "Heartbreak theme"}},
-        {"WHAT A WONDERFUL WORLD", "Song Title", {"Louis Armstrong", "Classic song", "Optimistic lyrics"}},
-        {"LA DANZA", "Song Title", {"By John Summit", "Summery/Vacation Song", "Dance/Electornic Genre"}},
-        {"WATCH THE SUNRISE", "Song Title", {"By Chris Lake", "Cheerful house music mix", "On his album 'Chemistry'"}},
-        {"HOW TO SAVE A LIFE", "Song Title", {"The Fray", "Piano-driven song", "Storytelling lyrics"}},
-        {"POCKETFUL OF SUNSHINE", "Song Title", {"Natasha Bedingfield", "Pop anthem", "'Sunshine'"}},
-        {"SWEET DEPOSITION", "Song Title", {"Remix of the Australian band The Temper Trap", "House music", "John Summit"}},
-        {"GUATEMALA", "Song Title", {"Named after a Central American country", "Released in 2018", "Performed by Rae Sremmurd, including Swae Lee and Slim Jxmmi"}},
-
-        // COUNTRIES
-        {"BOSNIA AND HERZEGOVINA", "Country", {"Balkan country", "Capital is Sarajevo", "Known for mountains"}},
-        {"CZECH REPUBLIC", "Country", {"Central Europe", "Capital Prague", "Famous castles"}},
-        {"UNITED ARAB EMIRATES", "Country", {"Middle East", "Dubai city", "Desert and skyscrapers"}},
-        {"TRINIDAD AND TOBAGO", "Country", {"Caribbean", "Famous for Carnival", "Two islands"}},
-        {"NORTH MACEDONIA", "Country", {"Balkan country", "Capital Skopje", "Historic sites"}},
-        {"EL SALVADOR", "Country", {"Central America", "Capital San Salvador", "Known for volcanoes"}},
-        {"DEMOCRATIC REPUBLIC OF THE CONGO", "Country", {"African country", "Capital Kinshasa", "Rainforest region"}},
-        {"VATICAN CITY", "Country", {"Smallest country", "Inside Rome", "Pope resides here"}},
-        {"LIECHTENSTEIN", "Country", {"Tiny European country", "Between Switzerland and Austria", "Alpine landscape"}},
-
-        // PLACE
-        {"MOUNT EVEREST", "Place", {"Tallest mountain", "Located in Himalayas", "Climbers dream"}},
-        {"THE SAHARA DESERT", "Place", {"World's largest desert", "North Africa", "Sand dunes"}},
-        {"EIFFEL TOWER", "Place", {"Paris landmark", "Iron structure", "Tourist attraction"}},
-        {"NIAGARA FALLS", "Place", {"Waterfalls", "Border USA/Canada", "Famous tourist site"}},
-        {"THE GREAT WALL OF CHINA", "Place", {"Ancient fortification", "Visible from space myth", "China"}},
-        {"AMAZON RAINFOREST", "Place", {"South America", "Dense jungle", "Biodiversity hotspot"}},
-        {"MOUNT KILIMANJARO", "Place", {"Tallest African mountain", "Volcano", "Located in Tanzania"}},
-        {"MIDDLESEX COLLEGE", "Place", {"University", "Campus buildings", "Ontario, Canada"}},
-
-        // QUOTATION
-        {"TO BE OR NOT TO BE THAT IS THE QUESTION", "Quotation", {"Hamlet quote", "Shakespeare", "Famous soliloquy"}},
-        {"I THINK THEREFORE I AM", "Quotation", {"Philosophy", "Descartes", "Cogito ergo sum"}},
-
-        // THING
-        {"ELECTRIC GUITAR", "Thing", {"Musical instrument", "Has strings", "Used in rock music"}},
-        {"VINTAGE CAMERA", "Thing", {"Old camera", "Film-based", "Collectible item"}},
-        {"SEWING MACHINE", "Thing", {"Stitching device", "Fabric crafting", "Often mechanical"}},
-        {"VINYL RECORD", "Thing", {"Music medium", "Rotating disc", "Classic sound"}},
-        {"BINOCULARS", "Thing", {"Magnifying device", "Used for viewing", "Hand-held optics"}},
-        {"HARMONICA", "Thing", {"Small instrument", "Played with mouth", "Blues music"}} ,
-
-        // ARTISTS
-        {"MICHAEL JACKSON", "Artist", {"King of Pop", "Thriller album", "Famous dancer"}},
-        {"ELVIS PRESLEY", "Artist", {"King of Rock", "Graceland home", "Famous singer"}},
-        {"WHITNEY HOUSTON", "Artist", {"Powerful vocals", "I Will Always Love You", "Pop icon"}},
-        {"CELINE DION", "Artist", {"Canadian singer", "Titanic theme song", "Powerful ballads"}},
-        {"JOHN SUMMIT", "Artist", {"Electronic DJ", "House music", "Festival performer"}},
-        {"ODD MOB", "Artist", {"Australian duo", "Electronic music", "Popular in festivals"}},
-        {"AYYBO", "Artist", {"Electronic artist", "Dance tracks", "Performed at VELD Sirkus stage in 2025"}},
-        {"DOM DOLLA", "Artist", {"House DJ", "Australian", "Known for his hit song Girl$"}}
-    };
-
-    lastEasyIndex = -1;
-    lastHardIndex = -1;
-}
-
-// Randomly selects a phrase from a category, based on the difficulty level selected by the user
-Phrase PhraseLibrary::getRandomPhrase(const std::string &difficulty) {
-    if (difficulty == "easy" && !easyPhrase.empty()) {
-        int index;
-        do {
-            index = std::rand() % easyPhrase.size();
-        } while (index == lastEasyIndex && easyPhrase.size() > 1);
-        lastEasyIndex = index;
-        return easyPhrase[index];
+#include "PhraseScorer.h"
+
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDir>
+#include <QFileInfo>
+#include <QThreadPool>
+
+#include <algorithm>
+#include <iterator>
+
+namespace {
+
+// Built-in categories, the enum value is the category id
+enum BuiltinCategory { Food, Animal, MovieTitle, SongTitle, Country, Place, Quotation, Thing, Artist };
+
+constexpr std::string_view builtinCategories[] = {
+    "Food", "Animal", "Movie Title", "Song Title", "Country", "Place", "Quotation", "Thing", "Artist"
+};
+
+// Built-in phrase record, the whole table lives in read-only data and needs no construction
+struct BuiltinPhrase {
+    std::string_view text;
+    BuiltinCategory category;
+    std::array<std::string_view, 3> hints;
+};
+
+// EASY PHRASES
+constexpr BuiltinPhrase easyPhrases[] = {
+    // FOOD
+    {"CHOCOLATE CAKE", Food, {"Sweet dessert", "Made from cocoa", "Popular birthday treat"}},
+    {"APPLE PIE", Food, {"Classic Fall dessert", "Often served with ice cream", "Made with fruit filling"}},
+    {"PEPPERONI PIZZA", Food, {"Italian dish", "Often round in shape", "Baked in oven"}},
+    {"MAC AND CHEESE", Food, {"Cheesy comfort food", "Pasta dish", "Can be baked"}},
+    {"STRAWBERRY JAM", Food, {"Spreadable fruit", "Made from berries", "Sweet taste"}},
+    {"CHOCOLATE CHIP COOKIE", Food, {"Baked treat", "Has chocolate chunks", "Often a circular shape"}},
+    {"FRUIT SALAD", Food, {"Mix of fruits", "Healthy option", "Often served chilled"}},
+
+    // ANIMAL
+    {"POLAR BEAR", Animal, {"Arctic animal", "White fur", "Largest land carnivore"}},
+    {"ORANGE CAT", Animal, {"Domestic pet", "Cartoon charcater Garfield", "Often orange colored"}},
+    {"BLUE WHALE", Animal, {"Largest animal on Earth", "Lives in ocean", "Makes loud sounds"}},
+    {"GRAY WOLF", Animal, {"Lives in packs", "Gray fur", "Carnivorous mammal"}},
+    {"SEA TURTLE", Animal, {"Marine reptile", "Lives in ocean", "Can live long"}},
+    {"GOLDEN RETRIEVER", Animal, {"Friendly dog breed", "Golden fur", "Good family pet"}},
+
+    // MOVIE TITLE
+    {"TOY STORY", MovieTitle, {"Animated movie", "Buzz and Woody", "Toys come to life"}},
+    {"JURASSIC PARK", MovieTitle, {"Dinosaurs", "Adventure film", "Directed by Spielberg"}},
+    {"HARRY POTTER", MovieTitle, {"Wizard story", "Magic school", "Famous books adaptation"}},
+    {"TANGLED", MovieTitle, {"Story about long hair", "Disney animation", "Rapunzel"}},
+    {"THE LION KING", MovieTitle, {"Disney classic", "Lion protagonist", "Africa setting"}},
+    {"FINDING NEMO", MovieTitle, {"Clownfish", "Ocean adventure", "Father searches for son"}},
+    {"MONSTERS INC", MovieTitle, {"One eyed monster", "Funny monsters", "Pixar animation"}},
+    {"THE LITTLE MERMAID", MovieTitle, {"Mermaid protagonist", "Main character wants to be human", "Underwater story"}},
+
+    // SONG TITLE
+    {"SHAKE IT OFF", SongTitle, {"Taylor Swift hit", "Pop genre", "About ignoring critics"}},
+    {"COUNTING STARS", SongTitle, {"OneRepublic hit", "Pop-rock genre", "About dreams and money"}},
+    {"SHAPE OF YOU", SongTitle, {"Ed Sheeran hit", "Pop song", "Danceable tune"}},
+    {"FIREWORK", SongTitle, {"Katy Perry song", "Inspirational lyrics", "Pop genre"}},
+    {"LET IT GO", SongTitle, {"Frozen movie song", "Disney", "Powerful female vocals"}},
+    {"BLANK SPACE", SongTitle, {"Taylor Swift", "Pop hit", "Satirical love song"}},
+    {"HEY BROTHER", SongTitle, {"Avicii song", "Electronic music", "Family-themed lyrics"}},
+    {"DON'T YOU WORRY CHILD", SongTitle, {"Swedish House Mafia", "EDM hit", "Emotional lyrics"}},
+    {"UNDER CONTROL", SongTitle, {"Calvin Harris", "EDM track", "Upbeat dance song"}},
+    {"MIRACLE MAKER", SongTitle, {"By Dom Dolla", "House music genre", "Uplifting lyrics"}},
+    {"HAVANA", SongTitle, {"Camila Cabello", "Cuban influence", "Pop hit"}},
+    {"FEEL SO CLOSE", SongTitle, {"Calvin Harris track", "Dance song", "Electronic music"}},
+    {"HEADLINES", SongTitle, {"Drake song", "Hip-hop", "Catchy lyrics"}},
+    {"DIE YOUNG", SongTitle, {"Ke$ha hit", "Party song", "Upbeat tempo"}},
+    {"AM I WRONG", SongTitle, {"Nico & Vinz", "Pop song", "Motivational lyrics"}},
+    {"RHYTHM AS A DANCER", SongTitle, {"Snap!", "80s hit", "Dance song"}},
+    {"TELEPHONE", SongTitle, {"Lady Gaga", "Pop hit", "Collab with Beyoncé"}},
+    {"LEAN ON ME", SongTitle, {"Church Song", "Inspirational", "Helping friends"}},
+    {"LEAN ON", SongTitle, {"Major Lazer", "Electronic", "Collaborative track"}},
+
+    // COUNTRIES
+    {"ITALY", Country, {"Famous for pasta", "Rome is the capital", "Home of the Colosseum"}},
+    {"POLAND", Country, {"Eastern Europe", "Warsaw capital", "Famous for pierogi"}},
+    {"SOUTH KOREA", Country, {"Capital is Seoul", "K-pop music", "Technologically advanced"}},
+    {"GREECE", Country, {"Olympic origins", "Athens capital", "Famous islands"}},
+    {"SWITZERLAND", Country, {"Neutral country", "Alps mountains", "Famous for chocolate"}},
+    {"AUSTRALIA", Country, {"Sydney Opera House", "Kangaroos", "Southern hemisphere"}},
+
+    // PLACE
+    {"AMUSEMENT PARK", Place, {"Roller coasters", "Fun rides", "Often has cotton candy"}},
+    {"THE ZOO", Place, {"Animals to see", "Educational trips", "Often for families"}},
+    {"THE BEACH", Place, {"Sand and water", "Sunbathing", "Swimming activities"}},
+    {"MOVIE THEATER", Place, {"Big screen", "Popcorn snacks", "Watch films"}},
+    {"COFFEE SHOP", Place, {"Hot beverages", "Relaxing spot", "Often Wi-Fi available"}},
+    {"WESTERN UNIVERSITY", Place, {"Educational institution", "Ontario location", "Campus life"}},
+    {"TRAMPOLINE PARK", Place, {"Jumping activity", "Indoor fun", "Exercise and play"}},
+
+    // QUOTATION
+    {"PRACTICE MAKES PERFECT", Quotation, {"Encourages repetition", "Learning advice", "Famous proverb"}},
+    {"BETTER LATE THAN NEVER", Quotation, {"Timing advice", "Don't procrastinate", "Common saying"}},
+    {"KNOWLEDGE IS POWER", Quotation, {"Famous saying", "Educational", "Importance of learning"}},
+    {"YOU ONLY LIVE ONCE", Quotation, {"YOLO", "Live life fully", "Popular phrase"}},
+    {"HOME SWEET HOME", Quotation, {"Comfort of home", "Family place", "Well-known proverb"}},
+    {"NEVER SAY NEVER", Quotation, {"Motivational", "Persistence advice", "Popular saying"}},
+    {"THE EARLY BIRD GETS THE WORM", Quotation, {"Wake up early", "Productivity advice", "Common proverb"}},
+    {"OUT OF SIGHT OUT OF MIND", Quotation, {"Forget easily", "Not nearby", "What you don't know can't harm you"}},
+
+    // THING
+    {"RED BALLOON", Thing, {"Round in shape", "Appears in the movie 'IT'", "Can float"}},
+    {"WATER BOTTLE", Thing, {"Container for liquids", "Portable", "Reusable"}},
+    {"TEDDY BEAR", Thing, {"Soft toy", "Resembles an animal", "Stuffed animal"}},
+    {"SUNGLASSES", Thing, {"Protects eyes", "Worn outdoors", "Fashion accessory"}},
+    {"COMPUTER MOUSE", Thing, {"Input device", "Connected to computer", "Hand-held"}},
+    {"PAINTBRUSH", Thing, {"Used in painting", "Holds paint", "Art tool"}},
+    {"UMBRELLA", Thing, {"Rain protection", "Portable", "Collapsible"}},
+    {"SKATEBOARD", Thing, {"Rolling board", "Sporting activity", "Trick performance"}},
+    {"HEADPHONES", Thing, {"Audio device", "Over ears or in ears", "Listen to music"}},
+    {"CANDLE", Thing, {"Wax object", "Provides light", "Often scented"}},
+
+    // ARTISTS
+    {"JUSTIN BIEBER", Artist, {"Pop singer", "Canadian", "Famous since 2009"}},
+    {"TAYLOR SWIFT", Artist, {"Country and pop singer", "Known for her song 'Love Story'", "Engaged to an NFL Player"}},
+    {"KATY PERRY", Artist, {"Pop singer", "Colorful performances", "California Dreams"}},
+    {"SELENA GOMEZ", Artist, {"Pop singer", "Actress", "Disney Channel star"}},
+    {"ARIANA GRANDE", Artist, {"Pop singer", "High vocal range", "Famous for ponytail"}},
+    {"BRUNO MARS", Artist, {"Pop/R&B singer", "Performs live", "Hit songs"}},
+    {"ED SHEERAN", Artist, {"Singer-songwriter", "Guitarist", "Hit song Shape of You"}}
+};
+
+// HARD PHRASES
+constexpr BuiltinPhrase hardPhrases[] = {
+    // FOOD
+    {"PAPIYA", Food, {"Tropical fruit", "Sweet and juicy", "Often yellowish-orange"}},
+    {"POMMAGRANTE", Food, {"Fruit with seeds", "Juicy red inside", "Used in salads"}},
+    {"ELDERBERRY", Food, {"Dark berry", "Used in syrups", "Rich in antioxidants"}},
+    {"CHICKEN SOUVLAKI", Food, {"Greek dish", "Grilled meat", "Served with pita"}},
+    {"BRUSCHETTA", Food, {"Italian appetizer", "Toasted bread", "Topped with tomatoes"}},
+    {"CHARCUTERIE", Food, {"Assortment of meats", "Served as appetizer", "French origin"}},
+    {"GNOCCHI", Food, {"Italian pasta", "Potato-based", "Soft dumplings"}},
+    {"ESCARGOT", Food, {"French cuisine", "Often served in garlic butter", "Edible snails"}},
+    {"MASCARPONE CHEESE", Food, {"Italian cheese", "Used in desserts", "Soft and creamy"}},
+    {"BUCKWHEAT", Food, {"Grain-like seed", "Used in pancakes", "Gluten-free option"}},
+    {"TIRAMISU", Food, {"Italian dessert", "Coffee-flavored", "Layered with mascarpone"}},
+
+    // ANIMAL
+    {"HIPPOPOTAMUS", Animal, {"Large African mammal", "Spends time in water", "Herbivore"}},
+    {"CATERPILLAR", Animal, {"Larval stage", "Becomes butterfly", "Soft body"}},
+    {"ORANGUTAN", Animal, {"Large ape", "Lives in trees", "Red fur"}},
+    {"CHIMPANZEE", Animal, {"Intelligent ape", "Lives in Africa", "Uses tools"}},
+    {"RHINOCEROS", Animal, {"Horned mammal", "Thick skin", "Large herbivore"}},
+    {"TASMANIAN DEVIL", Animal, {"Australian marsupial", "Aggressive", "Black fur"}},
+    {"TARANTULA", Animal, {"Large spider", "Hairy body", "Venomous bite"}},
+
+    // MOVIE TITLE
+    {"PIRATES OF THE CARIBBEAN", MovieTitle, {"Johnny Depp stars", "Jack Sparrow", "Pirates"}},
+    {"THE LORD OF THE RINGS", MovieTitle, {"Fantasy epic", "Frodo journey", "Based on Tolkien books"}},
+    {"THE CHRONICLES OF NARNIA", MovieTitle, {"Fantasy world", "Children enter wardrobe", "Magical creatures"}},
+    {"A STREETCAR NAMED DESIRE", MovieTitle, {"Classic play adaptation", "Tennessee Williams", "Drama"}},
+    {"HOW TO TRAIN YOUR DRAGON", MovieTitle, {"Animated film", "Viking boy", "Dragon companion"}},
+    {"THE SECRET LIFE OF PETS", MovieTitle, {"Animated comedy", "Pets' adventures", "City setting"}},
+    {"SPIDERMAN INTO THE SPIDERVERSE", MovieTitle, {"Multiple Spider-Men", "Animated film", "Superhero story"}},
+
+    // SONG TITLE
+    {"SMELLS LIKE TEEN SPIRIT", SongTitle, {"Nirvana song", "1990s grunge", "Famous guitar riff"}},
+    {"VIVA LA VIDA", SongTitle, {"Coldplay song", "Orchestral pop", "Historical references"}},
+    {"STAIRWAY TO HEAVEN", SongTitle, {"Led Zeppelin song", "Classic rock", "Epic guitar solo"}},
+    {"ANOTHER ONE BITES THE DUST", SongTitle, {"Queen song", "Funk rock", "Bass-driven track"}},
+    {"BOHEMIAN RHAPSODY", SongTitle, {"Queen hit", "Operatic sections", "Famous music video"}},
+    {"SINCE U BEEN GONE", SongTitle, {"Kelly Clarkson", "Pop-rock", "Breakup anthem"}},
+    {"SOMEBODY THAT I USED TO KNOW", SongTitle, {"Gotye song", "Duet", "Heartbreak theme"}},
+    {"WHAT A WONDERFUL WORLD", SongTitle, {"Louis Armstrong", "Classic song", "Optimistic lyrics"}},
+    {"LA DANZA", SongTitle, {"By John Summit", "Summery/Vacation Song", "Dance/Electornic Genre"}},
+    {"WATCH THE SUNRISE", SongTitle, {"By Chris Lake", "Cheerful house music mix", "On his album 'Chemistry'"}},
+    {"HOW TO SAVE A LIFE", SongTitle, {"The Fray", "Piano-driven song", "Storytelling lyrics"}},
+    {"POCKETFUL OF SUNSHINE", SongTitle, {"Natasha Bedingfield", "Pop anthem", "'Sunshine'"}},
+    {"SWEET DEPOSITION", SongTitle, {"Remix of the Australian band The Temper Trap", "House music", "John Summit"}},
+    {"GUATEMALA", SongTitle, {"Named after a Central American country", "Released in 2018", "Performed by Rae Sremmurd, including Swae Lee and Slim Jxmmi"}},
+
+    // COUNTRIES
+    {"BOSNIA AND HERZEGOVINA", Country, {"Balkan country", "Capital is Sarajevo", "Known for mountains"}},
+    {"CZECH REPUBLIC", Country, {"Central Europe", "Capital Prague", "Famous castles"}},
+    {"UNITED ARAB EMIRATES", Country, {"Middle East", "Dubai city", "Desert and skyscrapers"}},
+    {"TRINIDAD AND TOBAGO", Country, {"Caribbean", "Famous for Carnival", "Two islands"}},
+    {"NORTH MACEDONIA", Country, {"Balkan country", "Capital Skopje", "Historic sites"}},
+    {"EL SALVADOR", Country, {"Central America", "Capital San Salvador", "Known for volcanoes"}},
+    {"DEMOCRATIC REPUBLIC OF THE CONGO", Country, {"African country", "Capital Kinshasa", "Rainforest region"}},
+    {"VATICAN CITY", Country, {"Smallest country", "Inside Rome", "Pope resides here"}},
+    {"LIECHTENSTEIN", Country, {"Tiny European country", "Between Switzerland and Austria", "Alpine landscape"}},
+
+    // PLACE
+    {"MOUNT EVEREST", Place, {"Tallest mountain", "Located in Himalayas", "Climbers dream"}},
+    {"THE SAHARA DESERT", Place, {"World's largest desert", "North Africa", "Sand dunes"}},
+    {"EIFFEL TOWER", Place, {"Paris landmark", "Iron structure", "Tourist attraction"}},
+    {"NIAGARA FALLS", Place, {"Waterfalls", "Border USA/Canada", "Famous tourist site"}},
+    {"THE GREAT WALL OF CHINA", Place, {"Ancient fortification", "Visible from space myth", "China"}},
+    {"AMAZON RAINFOREST", Place, {"South America", "Dense jungle", "Biodiversity hotspot"}},
+    {"MOUNT KILIMANJARO", Place, {"Tallest African mountain", "Volcano", "Located in Tanzania"}},
+    {"MIDDLESEX COLLEGE", Place, {"University", "Campus buildings", "Ontario, Canada"}},
+
+    // QUOTATION
+    {"TO BE OR NOT TO BE THAT IS THE QUESTION", Quotation, {"Hamlet quote", "Shakespeare", "Famous soliloquy"}},
+    {"I THINK THEREFORE I AM", Quotation, {"Philosophy", "Descartes", "Cogito ergo sum"}},
+
+    // THING
+    {"ELECTRIC GUITAR", Thing, {"Musical instrument", "Has strings", "Used in rock music"}},
+    {"VINTAGE CAMERA", Thing, {"Old camera", "Film-based", "Collectible item"}},
+    {"SEWING MACHINE", Thing, {"Stitching device", "Fabric crafting", "Often mechanical"}},
+    {"VINYL RECORD", Thing, {"Music medium", "Rotating disc", "Classic sound"}},
+    {"BINOCULARS", Thing, {"Magnifying device", "Used for viewing", "Hand-held optics"}},
+    {"HARMONICA", Thing, {"Small instrument", "Played with mouth", "Blues music"}},
+
+    // ARTISTS
+    {"MICHAEL JACKSON", Artist, {"King of Pop", "Thriller album", "Famous dancer"}},
+    {"ELVIS PRESLEY", Artist, {"King of Rock", "Graceland home", "Famous singer"}},
+    {"WHITNEY HOUSTON", Artist, {"Powerful vocals", "I Will Always Love You", "Pop icon"}},
+    {"CELINE DION", Artist, {"Canadian singer", "Titanic theme song", "Powerful ballads"}},
+    {"JOHN SUMMIT", Artist, {"Electronic DJ", "House music", "Festival performer"}},
+    {"ODD MOB", Artist, {"Australian duo", "Electronic music", "Popular in festivals"}},
+    {"AYYBO", Artist, {"Electronic artist", "Dance tracks", "Performed at VELD Sirkus stage in 2025"}},
+    {"DOM DOLLA", Artist, {"House DJ", "Australian", "Known for his hit song Girl$"}}
+};
+
+// Compile-time checks on the built-in tables
+
+// Phrase text may only use the letters A-Z, with spaces between words and apostrophes
+constexpr bool isValidText(std::string_view text) {
+    bool hasLetter = false;
+    for (char c : text) {
+        if (c >= 'A' && c <= 'Z')
+            hasLetter = true;
+        else if (c != ' ' && c != '\'')
+            return false;
+    }
+    return hasLetter && text.front() != ' ' && text.back() != ' ';
+}
+
+// Every phrase needs at least its first hint, and hints leave no gaps: view() stops counting
+// at the first empty one
+constexpr bool hasHints(const BuiltinPhrase &phrase) {
+    if (phrase.hints[0].empty())
+        return false;
+    for (std::size_t i = 1; i < phrase.hints.size(); i++) {
+        if (!phrase.hints[i].empty() && phrase.hints[i - 1].empty())
+            return false;
+    }
+    return true;
+}
+
+template <std::size_t N>
+constexpr bool allValid(const BuiltinPhrase (&phrases)[N]) {
+    for (const BuiltinPhrase &phrase : phrases) {
+        if (!isValidText(phrase.text) || !hasHints(phrase))
+            return false;
+    }
+    return true;
+}
+
+template <std::size_t N>
+constexpr bool contains(const BuiltinPhrase (&phrases)[N], std::string_view text, std::size_t end) {
+    for (std::size_t i = 0; i < end; i++) {
+        if (phrases[i].text == text)
+            return true;
+    }
+    return false;
+}
+
+template <std::size_t N, std::size_t M>
+constexpr bool hasDuplicates(const BuiltinPhrase (&easy)[N], const BuiltinPhrase (&hard)[M]) {
+    for (std::size_t i = 0; i < N; i++) {
+        if (contains(easy, easy[i].text, i) || contains(hard, easy[i].text, M))
+            return true;
+    }
+    for (std::size_t i = 0; i < M; i++) {
+        if (contains(hard, hard[i].text, i))
+            return true;
     }
-    else if (difficulty == "hard" && !hardPhrase.empty()) {
-        int index;
-        do {
-            index = std::rand() % hardPhrase.size();
-        } while (index == lastHardIndex && hardPhrase.size() > 1);
-        lastHardIndex = index;
-        return hardPhrase[index];
+    return false;
+}
+
+static_assert(allValid(easyPhrases), "Easy phrase with invalid characters or no hints");
+static_assert(allValid(hardPhrases), "Hard phrase with invalid characters or no hints");
+static_assert(!hasDuplicates(easyPhrases, hardPhrases), "Duplicate phrase text in the built-in tables");
+
+} // namespace
+
+// FNV-1a, only used to fingerprint phrase sources
+static std::uint64_t hashBytes(std::string_view bytes, std::uint64_t hash = 14695981039346656037ULL) {
+    for (char c : bytes) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
     }
-    else {
-        return {"No Phrases Available", "None", {}};
+    return hash;
+}
+
+// Uses a compiled phrase pack or a directory of shards instead of the built-in phrases
+PhraseLibrary::PhraseLibrary(const QString &path, qint64 shardCacheBytes) {
+    // Taken before opening, so a pack replaced while it loads is seen as changed again
+    const QByteArray source = sourceFingerprint(path).toUtf8();
+
+    if (QFileInfo(path).isDir())
+        shards.open(path, shardCacheBytes);
+    else
+        pack.open(path);
+
+    if (isLoaded())
+        contentFingerprint = hashBytes(std::string_view(source.constData(), static_cast<std::size_t>(source.size())));
+
+    // Every draw from a scored library needs the scores and the index, so they are computed
+    // here, on whichever thread loads the library, rather than by the first draw
+    if (scoredDifficulty())
+        index();
+}
+
+// The built-in phrases only change with the executable
+std::uint64_t PhraseLibrary::builtinFingerprint() {
+    static const std::uint64_t fingerprint = []() {
+        std::uint64_t hash = hashBytes("builtin");
+        for (const BuiltinPhrase &phrase : easyPhrases)
+            hash = hashBytes(phrase.text, hashBytes(std::string_view("\n", 1), hash));
+        for (const BuiltinPhrase &phrase : hardPhrases)
+            hash = hashBytes(phrase.text, hashBytes(std::string_view("\n", 1), hash));
+        return hash;
+    }();
+    return fingerprint;
+}
+
+QString PhraseLibrary::sourceFingerprint(const QString &path) {
+    const QFileInfo info(path);
+    QFileInfoList files;
+    if (info.isDir())
+        files = QDir(path).entryInfoList(QStringList() << "*.pack", QDir::Files, QDir::Name);
+    else if (info.exists())
+        files << info;
+
+    QString result;
+    for (const QFileInfo &file : files) {
+        result += file.fileName() + ":" + QString::number(file.size()) + ":"
+                  + QString::number(file.lastModified().toMSecsSinceEpoch()) + ";";
+    }
+    return result;
+}
+
+QString PhraseLibrary::defaultPath() {
+    const QString directory = QCoreApplication::applicationDirPath();
+    if (QFileInfo::exists(directory + "/phrases.pack"))
+        return directory + "/phrases.pack";
+    return directory + "/phrases";
+}
+
+static std::shared_ptr<const PhraseLibrary> sharedLibrary;
+static std::once_flag sharedLibraryLoaded;
+
+std::shared_ptr<const PhraseLibrary> PhraseLibrary::instance() {
+    std::call_once(sharedLibraryLoaded, []() {
+        std::atomic_store(&sharedLibrary, std::shared_ptr<const PhraseLibrary>(std::make_shared<PhraseLibrary>(defaultPath())));
+    });
+    return std::atomic_load(&sharedLibrary);
+}
+
+void PhraseLibrary::preload() {
+    QThreadPool::globalInstance()->start([]() { instance(); });
+}
+
+void PhraseLibrary::setInstance(std::shared_ptr<const PhraseLibrary> library) {
+    std::call_once(sharedLibraryLoaded, []() {});
+    std::atomic_store(&sharedLibrary, std::move(library));
+}
+
+static PhraseView view(const BuiltinPhrase &phrase) {
+    PhraseView result;
+    result.text = phrase.text;
+    result.category = builtinCategories[phrase.category];
+    result.categoryId = phrase.category;
+    result.hints = phrase.hints;
+    while (result.hintCount < static_cast<int>(result.hints.size()) && !result.hints[result.hintCount].empty())
+        result.hintCount++;
+    return result;
+}
+
+// Number of phrases available for a difficulty level
+int PhraseLibrary::size(int difficulty) const {
+    if (shards.isOpen())
+        return shards.size(difficulty);
+    if (pack.isOpen()) {
+        const int easyCount = static_cast<int>(pack.easyCount());
+        return difficulty == 0 ? easyCount : static_cast<int>(pack.size()) - easyCount;
+    }
+    return static_cast<int>(difficulty == 0 ? std::size(easyPhrases) : std::size(hardPhrases));
+}
+
+// Returns the phrase at an index within a difficulty level
+PhraseView PhraseLibrary::phrase(int difficulty, int index) const {
+    if (index < 0 || index >= size(difficulty))
+        return {};
+
+    PhraseView result;
+    if (shards.isOpen())
+        result = shards.phrase(difficulty, index);
+    else if (pack.isOpen())
+        result = pack.phrase(difficulty == 0 ? index : pack.easyCount() + index);
+    else
+        result = view(difficulty == 0 ? easyPhrases[index] : hardPhrases[index]);
+
+    result.id = firstId(difficulty) + index;
+    return result;
+}
+
+int PhraseLibrary::size() const {
+    return size(0) + size(1);
+}
+
+// Returns the phrase with a library-wide id
+PhraseView PhraseLibrary::phrase(int id) const {
+    const int difficulty = storedDifficultyOf(id);
+    return phrase(difficulty, id - firstId(difficulty));
+}
+
+bool PhraseLibrary::scoredDifficulty() const {
+    const std::uint32_t flags = shards.isOpen() ? shards.flags() : pack.isOpen() ? pack.flags() : 0;
+    return flags & PhrasePackFormat::scoredDifficultyFlag;
+}
+
+// Difficulty level used for gameplay, from the manual split or from the phrase score
+int PhraseLibrary::difficultyOf(int id) const {
+    if (!scoredDifficulty())
+        return storedDifficultyOf(id);
+
+    scores();
+    return phraseScores[id] < scoreThreshold ? 0 : 1;
+}
+
+const std::vector<float> &PhraseLibrary::scores() const {
+    std::call_once(scoresComputed, [this]() {
+        phraseScores = PhraseScorer::score(*this);
+
+        // The median score splits a scored library into its easy and hard halves
+        if (!phraseScores.empty()) {
+            std::vector<float> sorted = phraseScores;
+            std::nth_element(sorted.begin(), sorted.begin() + sorted.size() / 2, sorted.end());
+            scoreThreshold = sorted[sorted.size() / 2];
+        }
+    });
+    return phraseScores;
+}
+
+const PhraseIndex &PhraseLibrary::index() const {
+    std::call_once(indexBuilt, [this]() { phraseIndex.build(*this); });
+    return phraseIndex;
+}
+
+const PhraseSolver &PhraseLibrary::solver() const {
+    std::call_once(solverBuilt, [this]() { phraseSolver.build(*this); });
+    return phraseSolver;
+}
+
+int PhraseLibrary::categoryCount() const {
+    if (shards.isOpen())
+        return shards.categoryCount();
+    if (pack.isOpen())
+        return static_cast<int>(pack.categoryCount());
+    return static_cast<int>(std::size(builtinCategories));
+}
+
+std::string_view PhraseLibrary::categoryName(int id) const {
+    if (id < 0 || id >= categoryCount())
+        return {};
+    if (shards.isOpen())
+        return shards.categoryName(id);
+    if (pack.isOpen())
+        return pack.category(static_cast<std::uint32_t>(id));
+    return builtinCategories[id];
+}
+
+// Id of a category name, or -1 if no phrase has that category
+int PhraseLibrary::findCategory(std::string_view name) const {
+    if (shards.isOpen())
+        return shards.findCategory(name);
+
+    const int count = categoryCount();
+    for (int id = 0; id < count; id++) {
+        if (categoryName(id) == name)
+            return id;
     }
+    return -1;
 }
@@ -1,25 +1,113 @@
 #ifndef PHRASELIBRARY_H
 #define PHRASELIBRARY_H
 
-#include <vector>
-#include <string>
+#include "PhraseIndex.h"
+#include "PhrasePack.h"
+#include "PhraseSolver.h"
+#include "PhraseView.h"
+#include "ShardedPhraseSource.h"
 
-struct Phrase {
-    std::string text;
-    std::string category;
-    std::vector<std::string> hints;
-};
+#include <memory>
+#include <mutex>
 
+// Immutable phrase corpus snapshot, shared by every game session.
+// Per-session selection state lives in PhraseSelector. When the phrase source changes on
+// disk, PhraseLibraryWatcher loads a new snapshot and swaps it in as the shared instance;
+// sessions still holding the old snapshot keep it alive until they move on.
 class PhraseLibrary {
 private:
-    std::vector<Phrase> easyPhrase;
-    std::vector<Phrase> hardPhrase;
-    int lastEasyIndex;
-    int lastHardIndex;
+    PhrasePack pack;
+    ShardedPhraseSource shards;
+
+    // Built on first use so constructing the library stays cheap
+    mutable std::once_flag indexBuilt;
+    mutable PhraseIndex phraseIndex;
+    mutable std::once_flag solverBuilt;
+    mutable PhraseSolver phraseSolver;
+    mutable std::once_flag scoresComputed;
+    mutable std::vector<float> phraseScores;
+    mutable float scoreThreshold = 0.0f;
+
+    std::uint64_t contentFingerprint = builtinFingerprint();
+
+    static std::uint64_t builtinFingerprint();
+
+    int storedDifficultyOf(int id) const { return id < size(0) ? 0 : 1; }
 
 public:
-    PhraseLibrary();
-    Phrase getRandomPhrase(const std::string &difficulty);
+    static constexpr qint64 defaultShardCacheBytes = 256 * 1024 * 1024;
+
+    // Built-in phrases only, constructing the library costs nothing
+    PhraseLibrary() = default;
+
+    // Loads a compiled phrase pack, or a directory of pack shards streamed through a cache of
+    // at most shardCacheBytes. Keeps the built-in phrases if neither can be used.
+    explicit PhraseLibrary(const QString &path, qint64 shardCacheBytes = defaultShardCacheBytes);
+
+    PhraseLibrary(const PhraseLibrary &) = delete;
+    PhraseLibrary &operator=(const PhraseLibrary &) = delete;
+
+    // Current process-wide snapshot, loaded on first use (thread-safe)
+    static std::shared_ptr<const PhraseLibrary> instance();
+
+    // Loads the shared snapshot on a worker thread, instance() only waits if it is called
+    // before the load has finished
+    static void preload();
+
+    // Atomically replaces the shared snapshot, new rounds pick from it
+    static void setInstance(std::shared_ptr<const PhraseLibrary> library);
+
+    // Phrase pack (or "phrases" shard directory) shipped next to the executable
+    static QString defaultPath();
+
+    // Names, sizes and modification times of the pack files behind a phrase source, empty if
+    // there are none. Any edit of the source changes it.
+    static QString sourceFingerprint(const QString &path);
+
+    // Identifies the phrases of this snapshot, so state kept for one snapshot (e.g. a saved
+    // shuffle bag) is not applied to different phrases
+    std::uint64_t fingerprint() const { return contentFingerprint; }
+
+    // Phrases as stored, by their manual difficulty (0 = easy, 1 = hard). A scored library
+    // stores every phrase as easy.
+    int size(int difficulty) const;
+    PhraseView phrase(int difficulty, int index) const;
+
+    // Every phrase also has a library-wide id, stored easy phrases first and then hard phrases
+    int size() const;
+    int firstId(int difficulty) const { return difficulty == 0 ? 0 : size(0); }
+    PhraseView phrase(int id) const;
+
+    // A scored library has no manual easy/hard split: easy is the lower half of the
+    // difficulty scores and hard the upper half
+    bool scoredDifficulty() const;
+    int difficultyOf(int id) const;
+
+    // Categories are identified by small integer ids, names are stored once
+    int categoryCount() const;
+    std::string_view categoryName(int id) const;
+    int findCategory(std::string_view name) const;
+
+    // The derived data below covers every phrase: building it reads the whole corpus, also
+    // from shards (see ShardedPhraseSource), and keeps it in memory
+
+    // Automatic difficulty score (0-100) of every phrase, computed in parallel on first use.
+    // A scored library computes them, and its index, when it loads.
+    const std::vector<float> &scores() const;
+    float score(int id) const { return scores()[id]; }
+
+    // Attribute index used to answer PhraseQuery filters
+    const PhraseIndex &index() const;
+
+    // Board pattern index used to list the phrases that fit a partially solved board
+    const PhraseSolver &solver() const;
+
+    // False when the library fell back to the built-in phrases
+    bool isLoaded() const { return pack.isOpen() || shards.isOpen(); }
+
+    // Cache and draw latency figures when the library streams from shards
+    bool isSharded() const { return shards.isOpen(); }
+    ShardStats shardStats() const { return shards.stats(); }
 };
 
 #endif // PHRASELIBRARY_H
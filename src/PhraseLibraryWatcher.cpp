@@ -0,0 +1,118 @@
+// This file reloads the shared phrase library in the background when its source files change
+
+#include "PhraseLibraryWatcher.h"
+
+#include <QDebug>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFileInfo>
+
+#include <memory>
+
+// Quiet period after the last change before a reload starts
+static const int settleMillis = 500;
+
+PhraseLibraryWatcher::PhraseLibraryWatcher(const QString &path, QObject *parent)
+    : QObject(parent), path(path.isEmpty() ? PhraseLibrary::defaultPath() : path), followDefault(path.isEmpty())
+{
+    loader.setMaxThreadCount(1);
+
+    settleTimer.setSingleShot(true);
+    settleTimer.setInterval(settleMillis);
+    connect(&settleTimer, &QTimer::timeout, this, &PhraseLibraryWatcher::startReload);
+
+    connect(&watcher, &QFileSystemWatcher::fileChanged, this, &PhraseLibraryWatcher::sourceChanged);
+    connect(&watcher, &QFileSystemWatcher::directoryChanged, this, &PhraseLibraryWatcher::sourceChanged);
+
+    loadedFingerprint = PhraseLibrary::sourceFingerprint(this->path);
+    watchSource();
+}
+
+PhraseLibraryWatcher::~PhraseLibraryWatcher() {
+    loader.waitForDone();
+}
+
+// Watches the source and the directory holding it. A pack replaced by rename drops the
+// watch on the file, the directory watch still sees it come back.
+void PhraseLibraryWatcher::watchSource() {
+    const QFileInfo info(path);
+    QStringList paths;
+    if (info.exists())
+        paths << path;
+    if (info.absoluteDir().exists())
+        paths << info.absolutePath();
+
+    for (const QString &watched : paths) {
+        if (!watcher.files().contains(watched) && !watcher.directories().contains(watched))
+            watcher.addPath(watched);
+    }
+}
+
+void PhraseLibraryWatcher::sourceChanged() {
+    // Both default sources live in the executable's directory, which is always watched, so
+    // a pack added or removed there switches the source here
+    if (followDefault)
+        path = PhraseLibrary::defaultPath();
+
+    watchSource();
+    settleTimer.start();
+}
+
+void PhraseLibraryWatcher::startReload() {
+    if (reloading) {
+        reloadPending = true;
+        return;
+    }
+
+    // The watched directory also changes for unrelated files, a reload only starts when the
+    // source files differ from the loaded snapshot
+    const QString current = PhraseLibrary::sourceFingerprint(path);
+    if (current == loadedFingerprint)
+        return;
+
+    // An empty fingerprint means the source was removed, the current snapshot stays in use
+    if (current.isEmpty())
+        return;
+
+    reloading = true;
+    loadedFingerprint = current;
+
+    // Everything expensive happens on the loader thread: mapping the pack, and for a scored
+    // pack scoring and indexing (see PhraseLibrary). Only the result is reported back to this
+    // thread. An unscored source is indexed by the first filtered query, so a reload of a
+    // shard directory does not stream every shard through the cache.
+    const QString source = path;
+    loader.start([this, source]() {
+        QElapsedTimer timer;
+        timer.start();
+
+        auto library = std::make_shared<PhraseLibrary>(source);
+        const bool loaded = library->isLoaded();
+        if (loaded) {
+            PhraseLibrary::setInstance(library);
+            qInfo() << "Reloaded" << library->size() << "phrases from" << source << "in" << timer.elapsed() << "ms";
+        }
+
+        const int phraseCount = library->size();
+        QMetaObject::invokeMethod(this, [this, loaded, phraseCount]() {
+            finishReload(loaded, phraseCount);
+        }, Qt::QueuedConnection);
+    });
+}
+
+void PhraseLibraryWatcher::finishReload(bool loaded, int phraseCount) {
+    reloading = false;
+
+    if (loaded) {
+        emit libraryReloaded(phraseCount);
+    } else {
+        // A broken pack keeps the previous snapshot, a fixed pack is picked up by the next change
+        qWarning() << "Phrase source could not be loaded, keeping the current phrases:" << path;
+        emit reloadFailed(path);
+    }
+
+    if (reloadPending) {
+        reloadPending = false;
+        startReload();
+    }
+}
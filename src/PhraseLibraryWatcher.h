@@ -0,0 +1,47 @@
+#ifndef PHRASELIBRARYWATCHER_H
+#define PHRASELIBRARYWATCHER_H
+
+#include "PhraseLibrary.h"
+
+#include <QFileSystemWatcher>
+#include <QObject>
+#include <QString>
+#include <QThreadPool>
+#include <QTimer>
+
+// Reloads the shared PhraseLibrary when its phrase pack (or shard directory) changes on disk.
+// The new snapshot is loaded, scored and indexed on a worker thread and then swapped in
+// atomically, so the UI thread never waits on the disk. Rounds in progress keep the phrase
+// they were dealt; the next round is dealt from the new snapshot.
+class PhraseLibraryWatcher : public QObject {
+    Q_OBJECT
+
+public:
+    // Without a path the watcher follows PhraseLibrary::defaultPath(), so a phrases.pack
+    // dropped next to the executable later replaces the "phrases" shard directory
+    explicit PhraseLibraryWatcher(const QString &path = QString(), QObject *parent = nullptr);
+    ~PhraseLibraryWatcher() override;
+
+signals:
+    void libraryReloaded(int phraseCount);
+    void reloadFailed(const QString &path);
+
+private slots:
+    void sourceChanged();
+    void startReload();
+
+private:
+    void watchSource();
+    void finishReload(bool loaded, int phraseCount);
+
+    QString path;
+    bool followDefault;
+    QString loadedFingerprint;
+    QFileSystemWatcher watcher;
+    QTimer settleTimer;  // editors and deploy scripts touch the files several times in a row
+    QThreadPool loader;
+    bool reloading = false;
+    bool reloadPending = false;
+};
+
+#endif // PHRASELIBRARYWATCHER_H
@@ -0,0 +1,104 @@
+// This file maps a compiled phrase pack into memory and serves its phrases as views
+
+#include "PhrasePack.h"
+
+#include <QDebug>
+
+#include <cstring>
+
+using namespace PhrasePackFormat;
+
+PhrasePack::~PhrasePack() {
+    close();
+}
+
+// Maps the pack file and validates its header, returns false if the file is not a usable pack
+bool PhrasePack::open(const QString &path) {
+    close();
+
+    file.setFileName(path);
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+
+    const qint64 fileSize = file.size();
+    if (fileSize < static_cast<qint64>(sizeof(PackHeader))) {
+        qWarning() << "Phrase pack too small:" << path;
+        close();
+        return false;
+    }
+
+    data = file.map(0, fileSize);
+    if (!data) {
+        qWarning() << "Could not map phrase pack:" << path;
+        close();
+        return false;
+    }
+
+    std::memcpy(&header, data, sizeof(PackHeader));
+
+    const quint64 categoriesEnd = header.categoriesOffset + quint64(header.categoryCount) * sizeof(PackString);
+    const quint64 recordsEnd = header.recordsOffset + quint64(header.phraseCount) * sizeof(PackRecord);
+    const quint64 blobEnd = header.blobOffset + quint64(header.blobSize);
+
+    if (std::memcmp(header.magic, magic, sizeof(magic)) != 0
+        || header.version != version
+        || header.easyCount > header.phraseCount
+        || header.recordsOffset % alignof(PackRecord) != 0
+        || header.categoriesOffset % alignof(PackString) != 0
+        || categoriesEnd > quint64(fileSize)
+        || recordsEnd > quint64(fileSize)
+        || blobEnd > quint64(fileSize)) {
+        qWarning() << "Invalid phrase pack:" << path;
+        close();
+        return false;
+    }
+
+    categories = reinterpret_cast<const PackString *>(data + header.categoriesOffset);
+    records = reinterpret_cast<const PackRecord *>(data + header.recordsOffset);
+    blob = reinterpret_cast<const char *>(data + header.blobOffset);
+    return true;
+}
+
+void PhrasePack::close() {
+    if (data) {
+        file.unmap(data);
+        data = nullptr;
+    }
+    if (file.isOpen())
+        file.close();
+
+    header = PackHeader{};
+    categories = nullptr;
+    records = nullptr;
+    blob = nullptr;
+}
+
+// Builds a view of one record, strings point straight into the mapped file
+PhraseView PhrasePack::phrase(std::uint32_t index) const {
+    PhraseView view;
+    if (!records || index >= header.phraseCount)
+        return view;
+
+    const PackRecord &record = records[index];
+    view.text = string(record.text);
+    view.categoryId = record.category;
+    view.category = category(record.category);
+    view.hintCount = record.hintCount < maxHints ? record.hintCount : maxHints;
+    for (int i = 0; i < view.hintCount; i++)
+        view.hints[i] = string(record.hints[i]);
+
+    return view;
+}
+
+std::string_view PhrasePack::category(std::uint32_t id) const {
+    if (!categories || id >= header.categoryCount)
+        return {};
+    return string(categories[id]);
+}
+
+// Strings are bounds-checked on access so a corrupt record can never read outside the blob
+std::string_view PhrasePack::string(const PackString &ref) const {
+    if (quint64(ref.offset) + ref.length > header.blobSize)
+        return {};
+    return std::string_view(blob + ref.offset, ref.length);
+}
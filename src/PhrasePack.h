@@ -0,0 +1,45 @@
+#ifndef PHRASEPACK_H
+#define PHRASEPACK_H
+
+#include "PhrasePackFormat.h"
+#include "PhraseView.h"
+
+#include <QFile>
+#include <QString>
+
+#include <cstdint>
+
+// Read-only, memory-mapped access to a compiled phrase pack
+class PhrasePack {
+public:
+    PhrasePack() = default;
+    ~PhrasePack();
+
+    PhrasePack(const PhrasePack &) = delete;
+    PhrasePack &operator=(const PhrasePack &) = delete;
+
+    bool open(const QString &path);
+    void close();
+
+    bool isOpen() const { return records != nullptr; }
+    std::uint32_t size() const { return header.phraseCount; }
+    std::uint32_t easyCount() const { return header.easyCount; }
+    std::uint32_t flags() const { return header.flags; }
+
+    PhraseView phrase(std::uint32_t index) const;
+
+    std::uint32_t categoryCount() const { return header.categoryCount; }
+    std::string_view category(std::uint32_t id) const;
+
+private:
+    std::string_view string(const PhrasePackFormat::PackString &ref) const;
+
+    QFile file;
+    uchar *data = nullptr;
+    PhrasePackFormat::PackHeader header{};
+    const PhrasePackFormat::PackString *categories = nullptr;
+    const PhrasePackFormat::PackRecord *records = nullptr;
+    const char *blob = nullptr;
+};
+
+#endif // PHRASEPACK_H
@@ -0,0 +1,60 @@
+#ifndef PHRASEPACKFORMAT_H
+#define PHRASEPACKFORMAT_H
+
+#include <cstdint>
+
+/*
+ * On-disk layout of a compiled phrase pack (see tools/phrasepack).
+ *
+ *   PackHeader
+ *   PackString[categoryCount] category names, records refer to them by index
+ *   PackRecord[phraseCount]   easy records first, then hard records
+ *   blob[blobSize]            every distinct string of the pack, back to back
+ *
+ * All integers are little-endian and every string is stored as an
+ * offset/length pair into the blob, so a pack can be memory-mapped and
+ * served without any per-phrase allocation. Repeated strings (hints
+ * shared by several phrases) are stored once in the blob.
+ */
+
+namespace PhrasePackFormat {
+
+const char magic[4] = { 'S', 'S', 'P', 'K' };
+const std::uint32_t version = 2;
+const int maxHints = 3;
+
+// Header flags
+const std::uint32_t scoredDifficultyFlag = 1;  // no manual easy/hard split, difficulty comes from phrase scores
+
+struct PackHeader {
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t phraseCount;
+    std::uint32_t easyCount;      // records [0, easyCount) are easy, the rest are hard
+    std::uint32_t recordsOffset;  // byte offset of the record table from the start of the file
+    std::uint32_t blobOffset;     // byte offset of the string blob from the start of the file
+    std::uint32_t blobSize;
+    std::uint32_t flags;
+    std::uint32_t categoriesOffset;  // byte offset of the category table from the start of the file
+    std::uint32_t categoryCount;
+};
+
+struct PackString {
+    std::uint32_t offset;  // relative to the start of the blob
+    std::uint32_t length;
+};
+
+struct PackRecord {
+    PackString text;
+    PackString hints[maxHints];
+    std::uint16_t category;   // index into the category table
+    std::uint8_t hintCount;
+    std::uint8_t difficulty;  // 0 = easy, 1 = hard
+};
+
+static_assert(sizeof(PackHeader) == 40, "PackHeader must match the on-disk layout");
+static_assert(sizeof(PackRecord) == 36, "PackRecord must match the on-disk layout");
+
+} // namespace PhrasePackFormat
+
+#endif // PHRASEPACKFORMAT_H
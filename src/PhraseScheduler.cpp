@@ -0,0 +1,73 @@
+// This file deals phrase indices from a shuffle bag so no phrase repeats until the pool is exhausted
+
+#include "PhraseScheduler.h"
+
+// SplitMix64 finaliser, used as the Feistel round function and to derive new bag seeds
+static std::uint64_t mix(std::uint64_t value) {
+    value += 0x9E3779B97F4A7C15ull;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+    return value ^ (value >> 31);
+}
+
+PhraseScheduler::PhraseScheduler(std::uint32_t poolSize, std::uint64_t seed) {
+    setPoolSize(poolSize);
+    state.seed = seed;
+}
+
+bool PhraseScheduler::restore(const ScheduleState &saved) {
+    if (saved.poolSize == 0 || saved.cursor > saved.poolSize)
+        return false;
+    if (isValid() && saved.poolSize != state.poolSize)
+        return false;
+
+    setPoolSize(saved.poolSize);
+    state = saved;
+    return true;
+}
+
+// The permutation works on the smallest even number of bits that covers the pool
+void PhraseScheduler::setPoolSize(std::uint32_t poolSize) {
+    state.poolSize = poolSize;
+    state.cursor = 0;
+
+    int bits = 2;
+    while (bits < 32 && (std::uint64_t(1) << bits) < poolSize)
+        bits += 2;
+    halfBits = bits / 2;
+}
+
+// Maps a bag position to a pool index. The Feistel network is a bijection on [0, 2^bits),
+// walking the cycle until the result falls inside the pool keeps it a bijection on the pool.
+std::uint32_t PhraseScheduler::permute(std::uint64_t seed, std::uint32_t index) const {
+    const std::uint32_t mask = (std::uint32_t(1) << halfBits) - 1;
+    std::uint32_t value = index;
+
+    do {
+        std::uint32_t left = value >> halfBits;
+        std::uint32_t right = value & mask;
+        for (int round = 0; round < 4; round++) {
+            const std::uint32_t next = left ^ (static_cast<std::uint32_t>(mix(seed + round * 0x632BE59BD9B4E019ull + right)) & mask);
+            left = right;
+            right = next;
+        }
+        value = (left << halfBits) | right;
+    } while (value >= state.poolSize);
+
+    return value;
+}
+
+std::uint32_t PhraseScheduler::next() {
+    if (!isValid())
+        return 0;
+
+    if (state.cursor >= state.poolSize) {
+        const std::uint32_t last = permute(state.seed, state.poolSize - 1);
+        do {
+            state.seed = mix(state.seed);
+        } while (state.poolSize > 1 && permute(state.seed, 0) == last);
+        state.cursor = 0;
+    }
+
+    return permute(state.seed, state.cursor++);
+}
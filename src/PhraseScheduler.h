@@ -0,0 +1,40 @@
+#ifndef PHRASESCHEDULER_H
+#define PHRASESCHEDULER_H
+
+#include <cstdint>
+
+// Compact scheduler state, this is all that needs to be stored per player and pool
+struct ScheduleState {
+    std::uint64_t seed = 0;
+    std::uint32_t cursor = 0;
+    std::uint32_t poolSize = 0;
+};
+
+// Shuffle-bag scheduler: deals every index of a pool once, in a random order, before any
+// index repeats. The order is a keyed permutation computed on the fly (a small Feistel
+// network with cycle-walking), so no shuffled array is stored and each draw is O(1).
+class PhraseScheduler {
+public:
+    PhraseScheduler() = default;
+    PhraseScheduler(std::uint32_t poolSize, std::uint64_t seed);
+
+    // Continues from a saved state, returns false (and leaves the scheduler unchanged) if
+    // the state belongs to a pool of a different size
+    bool restore(const ScheduleState &saved);
+
+    bool isValid() const { return state.poolSize > 0; }
+    const ScheduleState &currentState() const { return state; }
+
+    // Next index in [0, poolSize). When the bag is empty a new one is dealt, and its first
+    // index is never the one that was just drawn.
+    std::uint32_t next();
+
+private:
+    std::uint32_t permute(std::uint64_t seed, std::uint32_t index) const;
+    void setPoolSize(std::uint32_t poolSize);
+
+    ScheduleState state;
+    int halfBits = 1;
+};
+
+#endif // PHRASESCHEDULER_H
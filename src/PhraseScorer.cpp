@@ -0,0 +1,139 @@
+// This file computes an automatic difficulty score for every phrase of the corpus
+
+#include "PhraseScorer.h"
+#include "Parallel.h"
+#include "PhraseLibrary.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+// Weights of each feature, they add up to 1
+static const double rarityWeight = 0.25;
+static const double distinctWeight = 0.20;
+static const double vowelWeight = 0.15;
+static const double wordWeight = 0.10;
+static const double lengthWeight = 0.10;
+static const double patternWeight = 0.20;
+
+static bool isVowel(char c) {
+    return c == 'A' || c == 'E' || c == 'I' || c == 'O' || c == 'U';
+}
+
+// Hash of the blank pattern, i.e. the sequence of word lengths ("THE ZOO" -> 3,3)
+static std::uint64_t patternHash(std::string_view text) {
+    std::uint64_t hash = 1469598103934665603ull;
+    for (char c : text) {
+        hash ^= static_cast<unsigned char>(c == ' ' ? ' ' : '_');
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+float PhraseScorer::score(std::string_view text, const double letterFrequency[26],
+                          std::size_t patternShare, std::size_t corpusSize) {
+    int letters = 0;
+    int vowels = 0;
+    int words = 0;
+    bool inWord = false;
+    std::uint32_t seen = 0;
+    double information = 0.0;
+
+    for (char c : text) {
+        if (c >= 'A' && c <= 'Z') {
+            letters++;
+            if (isVowel(c))
+                vowels++;
+            const std::uint32_t bit = 1u << (c - 'A');
+            if (!(seen & bit)) {
+                seen |= bit;
+                const double frequency = letterFrequency[c - 'A'];
+                information += -std::log2(frequency > 0.0 ? frequency : 1e-6);
+            }
+        }
+        if (c == ' ') {
+            inWord = false;
+        } else if (!inWord) {
+            inWord = true;
+            words++;
+        }
+    }
+
+    if (letters == 0)
+        return 0.0f;
+
+    int distinct = 0;
+    for (std::uint32_t bits = seen; bits; bits &= bits - 1)
+        distinct++;
+
+    // Each feature is scaled to [0, 1], 1 being the hardest
+    const double rarity = std::min(1.0, (information / distinct) / 8.0);
+    const double distinctLetters = std::min(1.0, distinct / 20.0);
+    const double vowelScarcity = 1.0 - static_cast<double>(vowels) / letters;
+    const double fewWords = 1.0 / words;
+    const double shortness = 1.0 - std::min(letters, 30) / 30.0;
+    const double ambiguity = corpusSize > 1 && patternShare > 1
+        ? std::log2(static_cast<double>(patternShare)) / std::log2(static_cast<double>(corpusSize))
+        : 0.0;
+
+    const double total = rarityWeight * rarity
+        + distinctWeight * distinctLetters
+        + vowelWeight * vowelScarcity
+        + wordWeight * fewWords
+        + lengthWeight * shortness
+        + patternWeight * ambiguity;
+
+    return static_cast<float>(100.0 * total);
+}
+
+// Two parallel passes: the first gathers corpus letter counts and blank pattern counts, the
+// second scores each phrase against those corpus-wide figures
+std::vector<float> PhraseScorer::score(const PhraseLibrary &library, unsigned threads) {
+    const std::size_t count = static_cast<std::size_t>(library.size());
+    std::vector<std::uint64_t> patterns(count);
+    std::vector<float> scores(count, 0.0f);
+
+    std::mutex mutex;
+    std::uint64_t letterCounts[26] = {};
+    std::unordered_map<std::uint64_t, std::size_t> patternCounts;
+
+    parallelFor(count, [&](std::size_t begin, std::size_t end) {
+        std::uint64_t localLetters[26] = {};
+        std::unordered_map<std::uint64_t, std::size_t> localPatterns;
+
+        for (std::size_t id = begin; id < end; id++) {
+            const PhraseView phrase = library.phrase(static_cast<int>(id));
+            for (char c : phrase.text) {
+                if (c >= 'A' && c <= 'Z')
+                    localLetters[c - 'A']++;
+            }
+            patterns[id] = patternHash(phrase.text);
+            localPatterns[patterns[id]]++;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        for (int i = 0; i < 26; i++)
+            letterCounts[i] += localLetters[i];
+        for (const auto &pattern : localPatterns)
+            patternCounts[pattern.first] += pattern.second;
+    }, threads);
+
+    std::uint64_t totalLetters = 0;
+    for (std::uint64_t letterCount : letterCounts)
+        totalLetters += letterCount;
+
+    double letterFrequency[26];
+    for (int i = 0; i < 26; i++)
+        letterFrequency[i] = totalLetters ? static_cast<double>(letterCounts[i]) / totalLetters : 0.0;
+
+    parallelFor(count, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t id = begin; id < end; id++) {
+            const PhraseView phrase = library.phrase(static_cast<int>(id));
+            scores[id] = score(phrase.text, letterFrequency, patternCounts.at(patterns[id]), count);
+        }
+    }, threads);
+
+    return scores;
+}
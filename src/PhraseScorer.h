@@ -0,0 +1,28 @@
+#ifndef PHRASESCORER_H
+#define PHRASESCORER_H
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+class PhraseLibrary;
+
+// Computes a difficulty score between 0 (easiest) and 100 (hardest) for every phrase of a
+// library, in parallel across all cores. The score combines:
+//   - how rare the phrase's letters are in the corpus
+//   - how many distinct letters must be found
+//   - how few vowels the phrase has
+//   - how few words and letters give context
+//   - how many corpus phrases share the same blank pattern (word lengths)
+class PhraseScorer {
+public:
+    // Scores indexed by library-wide phrase id
+    static std::vector<float> score(const PhraseLibrary &library, unsigned threads = 0);
+
+    // Score of one phrase given corpus letter frequencies (per letter, summing to 1) and the
+    // number of corpus phrases sharing its pattern out of corpusSize
+    static float score(std::string_view text, const double letterFrequency[26],
+                       std::size_t patternShare, std::size_t corpusSize);
+};
+
+#endif // PHRASESCORER_H
@@ -0,0 +1,139 @@
+// This file deals phrases for a game session so none repeats until its pool is exhausted
+
+#include "PhraseSelector.h"
+
+#include <algorithm>
+#include <utility>
+
+static PhraseView noPhrase() {
+    PhraseView none;
+    none.text = "No Phrases Available";
+    none.category = "None";
+    return none;
+}
+
+// Names the pool, the saved bag is only reused for the same phrases (the library fingerprint)
+static QString poolName(int difficulty, int size, bool scored) {
+    return QString(difficulty == 0 ? "easy-" : "hard-") + (scored ? "scored-" : "") + QString::number(size);
+}
+
+PhraseSelector::PhraseSelector(PhraseHistory *history, std::uint64_t seed)
+    : library(PhraseLibrary::instance()), followShared(true), history(history), seeds(seed)
+{
+}
+
+PhraseSelector::PhraseSelector(std::shared_ptr<const PhraseLibrary> library, PhraseHistory *history,
+                               std::uint64_t seed)
+    : library(std::move(library)), followShared(false), history(history), seeds(seed)
+{
+}
+
+// Picks up a reloaded shared library. Bags and cached matches belong to the old snapshot, the
+// saved bag of each difficulty is reloaded by pool name on the next draw.
+void PhraseSelector::refreshLibrary() {
+    if (!followShared)
+        return;
+
+    std::shared_ptr<const PhraseLibrary> current = PhraseLibrary::instance();
+    if (current == library)
+        return;
+
+    library = std::move(current);
+    for (int difficulty = 0; difficulty < 2; difficulty++) {
+        schedules[difficulty] = PhraseScheduler();
+        scoredPools[difficulty].clear();
+        scoredPoolBuilt[difficulty] = false;
+    }
+    queryPools.clear();
+}
+
+// Ties a view to the snapshot it came from, so it stays valid after a reload. A view from a
+// shard already owns its shard, the category names still live in the library.
+PhraseView PhraseSelector::owned(PhraseView view) const {
+    if (!view.owner)
+        view.owner = library;
+    else
+        view.owner = std::make_shared<std::pair<std::shared_ptr<const void>, std::shared_ptr<const PhraseLibrary>>>(view.owner, library);
+    return view;
+}
+
+// Loads the saved bag for a difficulty on first use, or deals a new one
+PhraseScheduler &PhraseSelector::difficultySchedule(int difficulty, int size) {
+    PhraseScheduler &schedule = schedules[difficulty];
+    if (!schedule.isValid()) {
+        schedule = PhraseScheduler(static_cast<std::uint32_t>(size), seeds());
+
+        ScheduleState saved;
+        if (history && history->load(poolName(difficulty, size, library->scoredDifficulty()), library->fingerprint(), saved))
+            schedule.restore(saved);
+    }
+    return schedule;
+}
+
+PhraseView PhraseSelector::getRandomPhrase(int difficulty) {
+    PhraseQuery query;
+    query.difficulty = difficulty == 0 ? 0 : 1;
+    return getRandomPhrase(query);
+}
+
+PhraseView PhraseSelector::getRandomPhrase(const PhraseQuery &query) {
+    refreshLibrary();
+
+    // A difficulty on its own has its own persistent bag. With a manual split the pool is a
+    // contiguous id range, in a scored library it is the half of the scores it covers.
+    if (query.difficultyOnly() && (query.difficulty == 0 || query.difficulty == 1)) {
+        const int difficulty = query.difficulty;
+        const bool scored = library->scoredDifficulty();
+
+        if (scored && !scoredPoolBuilt[difficulty]) {
+            scoredPools[difficulty] = library->index().match(query);
+            scoredPoolBuilt[difficulty] = true;
+        }
+
+        const int size = scored ? static_cast<int>(scoredPools[difficulty].size()) : library->size(difficulty);
+        if (size == 0)
+            return noPhrase();
+
+        PhraseScheduler &schedule = difficultySchedule(difficulty, size);
+        const std::uint32_t index = schedule.next();
+        if (history)
+            history->save(poolName(difficulty, size, scored), library->fingerprint(), schedule.currentState());
+
+        if (scored)
+            return owned(library->phrase(static_cast<int>(scoredPools[difficulty][index])));
+        return owned(library->phrase(difficulty, static_cast<int>(index)));
+    }
+
+    QueryPool &pool = queryPool(query);
+    if (pool.ids.empty())
+        return noPhrase();
+
+    return owned(library->phrase(static_cast<int>(pool.ids[pool.schedule.next()])));
+}
+
+// Finds the cached matches of a query, or looks them up in the index in place of the least
+// recently drawn query
+PhraseSelector::QueryPool &PhraseSelector::queryPool(const PhraseQuery &query) {
+    queryDraws++;
+    for (QueryPool &pool : queryPools) {
+        if (pool.query == query) {
+            pool.lastUse = queryDraws;
+            return pool;
+        }
+    }
+
+    if (queryPools.size() < maxQueryPools) {
+        queryPools.emplace_back();
+    } else {
+        std::iter_swap(std::min_element(queryPools.begin(), queryPools.end(),
+                                        [](const QueryPool &a, const QueryPool &b) { return a.lastUse < b.lastUse; }),
+                       queryPools.end() - 1);
+    }
+
+    QueryPool &pool = queryPools.back();
+    pool.query = query;
+    pool.ids = library->index().match(query);
+    pool.schedule = PhraseScheduler(static_cast<std::uint32_t>(pool.ids.size()), seeds());
+    pool.lastUse = queryDraws;
+    return pool;
+}
@@ -0,0 +1,62 @@
+#ifndef PHRASESELECTOR_H
+#define PHRASESELECTOR_H
+
+#include "PhraseHistory.h"
+#include "PhraseLibrary.h"
+#include "PhraseScheduler.h"
+#include "Random.h"
+
+#include <memory>
+
+// Per-session phrase selection on top of the shared PhraseLibrary.
+// Phrases are dealt from a shuffle bag, so nothing repeats until the whole pool has been
+// played. With a PhraseHistory the bag position of each difficulty survives between sessions.
+class PhraseSelector {
+public:
+    // Follows the shared library: when it is reloaded, the next draw switches to the new
+    // snapshot. Views already handed out keep the snapshot they came from alive. New bags are
+    // shuffled from the seed, so a session started with the same seed deals the same phrases.
+    explicit PhraseSelector(PhraseHistory *history = nullptr, std::uint64_t seed = Random::freshSeed());
+
+    // Always deals from the given library
+    explicit PhraseSelector(std::shared_ptr<const PhraseLibrary> library, PhraseHistory *history = nullptr,
+                            std::uint64_t seed = Random::freshSeed());
+
+    // Next phrase for a difficulty level (0 = easy, 1 = hard)
+    PhraseView getRandomPhrase(int difficulty);
+
+    // Next phrase matching a filter. The matching ids are looked up in the library index
+    // once per distinct query; the last few queries keep their ids and bag, so repeated draws,
+    // also when alternating between filters, are O(1).
+    PhraseView getRandomPhrase(const PhraseQuery &query);
+
+private:
+    void refreshLibrary();
+    PhraseView owned(PhraseView view) const;
+    PhraseScheduler &difficultySchedule(int difficulty, int size);
+
+    std::shared_ptr<const PhraseLibrary> library;
+    bool followShared;
+    PhraseHistory *history;
+    Random seeds;
+
+    PhraseScheduler schedules[2];
+    std::vector<std::uint32_t> scoredPools[2];
+    bool scoredPoolBuilt[2] = { false, false };
+
+    struct QueryPool {
+        PhraseQuery query;
+        std::vector<std::uint32_t> ids;
+        PhraseScheduler schedule;
+        std::uint64_t lastUse = 0;
+    };
+
+    static const std::size_t maxQueryPools = 8;  // the least recently drawn one is replaced
+
+    QueryPool &queryPool(const PhraseQuery &query);
+
+    std::vector<QueryPool> queryPools;
+    std::uint64_t queryDraws = 0;
+};
+
+#endif // PHRASESELECTOR_H
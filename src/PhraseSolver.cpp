@@ -0,0 +1,252 @@
+// This file narrows the phrase corpus down to the phrases that fit a partially revealed board
+
+#include "PhraseSolver.h"
+#include "PhraseBoard.h"
+#include "PhraseLibrary.h"
+
+#include <QtAlgorithms>
+
+static int letterIndex(char c) {
+    if (c >= 'a' && c <= 'z')
+        return c - 'a';
+    if (c >= 'A' && c <= 'Z')
+        return c - 'A';
+    return -1;
+}
+
+// Rank of a letter among the letters of a mask, i.e. its bitmap number within the mask
+static std::uint32_t rankOf(std::uint32_t mask, int letter) {
+    return static_cast<std::uint32_t>(qPopulationCount(mask & ((1u << letter) - 1)));
+}
+
+std::size_t PhraseSolver::Group::cellOffset(std::size_t cell, int letter) const {
+    return (base[cell] + rankOf(cellLetters[cell], letter)) * words;
+}
+
+std::size_t PhraseSolver::Group::presentOffset(int letter) const {
+    return (presentBase + rankOf(groupLetters, letter)) * words;
+}
+
+// Hidden cells, revealed letters and unguessable characters all keep the same shape
+std::string PhraseSolver::shapeOf(std::string_view text) {
+    std::string shape(text);
+    for (char &c : shape) {
+        if (c == '_' || letterIndex(c) >= 0)
+            c = '_';
+    }
+    return shape;
+}
+
+void PhraseSolver::build(const PhraseLibrary &library) {
+    shapes.clear();
+    groups.clear();
+
+    // First pass: sort the phrases into their shape groups, keeping their letters row by row
+    std::vector<std::string> groupLetters;
+    const int phraseCount = library.size();
+    for (int id = 0; id < phraseCount; id++) {
+        const PhraseView phrase = library.phrase(id);
+        const std::string shape = shapeOf(phrase.text);
+
+        auto found = shapes.find(shape);
+        if (found == shapes.end()) {
+            found = shapes.emplace(shape, static_cast<std::uint32_t>(groups.size())).first;
+
+            Group group;
+            for (std::size_t i = 0; i < shape.size() && i <= 0xFFFF; i++) {
+                if (shape[i] == '_')
+                    group.cells.push_back(static_cast<std::uint16_t>(i));
+            }
+            group.cellLetters.assign(group.cells.size(), 0);
+            groups.push_back(std::move(group));
+            groupLetters.emplace_back();
+        }
+
+        Group &group = groups[found->second];
+        std::string &letters = groupLetters[found->second];
+        group.ids.push_back(static_cast<std::uint32_t>(id));
+        group.categories.push_back(static_cast<std::uint16_t>(phrase.categoryId < 0 ? 0xFFFF : phrase.categoryId));
+        for (std::size_t cell = 0; cell < group.cells.size(); cell++) {
+            const int letter = letterIndex(phrase.text[group.cells[cell]]);
+            letters.push_back(static_cast<char>(letter));
+            group.cellLetters[cell] |= 1u << letter;
+            group.groupLetters |= 1u << letter;
+        }
+    }
+
+    // Second pass: lay out the bitmaps of every group and set one bit per row and cell
+    for (std::size_t g = 0; g < groups.size(); g++) {
+        Group &group = groups[g];
+        const std::size_t rows = group.ids.size();
+        const std::size_t cellCount = group.cells.size();
+        group.words = (rows + 63) / 64;
+
+        std::uint32_t bitmapCount = 0;
+        group.base.resize(cellCount);
+        for (std::size_t cell = 0; cell < cellCount; cell++) {
+            group.base[cell] = bitmapCount;
+            bitmapCount += static_cast<std::uint32_t>(qPopulationCount(group.cellLetters[cell]));
+        }
+        group.presentBase = bitmapCount;
+        bitmapCount += static_cast<std::uint32_t>(qPopulationCount(group.groupLetters));
+        group.bitmaps.assign(bitmapCount * group.words, 0);
+
+        const std::string &letters = groupLetters[g];
+        for (std::size_t row = 0; row < rows; row++) {
+            const std::uint64_t bit = std::uint64_t(1) << (row % 64);
+            for (std::size_t cell = 0; cell < cellCount; cell++) {
+                const int letter = letters[row * cellCount + cell];
+                group.bitmaps[group.cellOffset(cell, letter) + row / 64] |= bit;
+                group.bitmaps[group.presentOffset(letter) + row / 64] |= bit;
+            }
+        }
+    }
+}
+
+// Rows of the pattern's shape group that fit the evidence, or null when no phrase has its shape
+const PhraseSolver::Group *PhraseSolver::match(std::string_view pattern, std::uint32_t guessedLetters,
+                                               Bitmap &rows) const {
+    const auto found = shapes.find(shapeOf(pattern));
+    if (found == shapes.end())
+        return nullptr;
+
+    const Group &group = groups[found->second];
+    rows.assign(group.words, ~std::uint64_t(0));
+    if (group.ids.size() % 64 != 0)
+        rows.back() = (std::uint64_t(1) << (group.ids.size() % 64)) - 1;
+
+    // Guessed letters that are nowhere on the board cannot occur in the phrase at all, guessed
+    // letters that are shown cannot occur in any cell that is still hidden
+    std::uint32_t shownLetters = 0;
+    for (std::uint16_t position : group.cells) {
+        const int letter = letterIndex(pattern[position]);
+        if (letter >= 0)
+            shownLetters |= 1u << letter;
+    }
+
+    for (std::uint32_t absent = guessedLetters & ~shownLetters & group.groupLetters; absent; absent &= absent - 1) {
+        const std::uint64_t *bitmap = group.presentBitmap(qCountTrailingZeroBits(absent));
+        for (std::size_t i = 0; i < group.words; i++)
+            rows[i] &= ~bitmap[i];
+    }
+
+    const std::uint32_t shownGuesses = guessedLetters & shownLetters;
+    for (std::size_t cell = 0; cell < group.cells.size(); cell++) {
+        const int letter = letterIndex(pattern[group.cells[cell]]);
+        if (letter >= 0) {
+            if ((group.cellLetters[cell] & (1u << letter)) == 0) {
+                rows.assign(group.words, 0);
+                return &group;
+            }
+            const std::uint64_t *bitmap = group.cellBitmap(cell, letter);
+            for (std::size_t i = 0; i < group.words; i++)
+                rows[i] &= bitmap[i];
+        } else {
+            for (std::uint32_t excluded = shownGuesses & group.cellLetters[cell]; excluded; excluded &= excluded - 1) {
+                const std::uint64_t *bitmap = group.cellBitmap(cell, qCountTrailingZeroBits(excluded));
+                for (std::size_t i = 0; i < group.words; i++)
+                    rows[i] &= ~bitmap[i];
+            }
+        }
+    }
+    return &group;
+}
+
+// Categories are checked per surviving row, by then only a handful of rows are left
+void PhraseSolver::keepCategory(const Group &group, int categoryId, Bitmap &rows) {
+    if (categoryId < 0)
+        return;
+
+    for (std::size_t i = 0; i < rows.size(); i++) {
+        for (std::uint64_t bits = rows[i]; bits; bits &= bits - 1) {
+            const int bit = qCountTrailingZeroBits(bits);
+            if (group.categories[i * 64 + bit] != categoryId)
+                rows[i] &= ~(std::uint64_t(1) << bit);
+        }
+    }
+}
+
+std::string PhraseSolver::patternOf(const PhraseBoard &board) {
+    std::string pattern(static_cast<std::size_t>(board.length()), ' ');
+    for (int i = 0; i < board.length(); i++)
+        pattern[i] = board.cell(i);
+    return pattern;
+}
+
+std::vector<std::uint32_t> PhraseSolver::solve(const PhraseBoard &board, int categoryId) const {
+    return solve(patternOf(board), board.guessedMask(), categoryId);
+}
+
+std::vector<std::uint32_t> PhraseSolver::solve(std::string_view pattern, std::uint32_t guessedLetters,
+                                               int categoryId) const {
+    Bitmap rows;
+    const Group *group = match(pattern, guessedLetters, rows);
+    if (!group)
+        return {};
+    keepCategory(*group, categoryId, rows);
+
+    // Rows were added in id order, so the ids come out sorted
+    std::vector<std::uint32_t> ids;
+    for (std::size_t i = 0; i < rows.size(); i++) {
+        for (std::uint64_t bits = rows[i]; bits; bits &= bits - 1)
+            ids.push_back(group->ids[i * 64 + qCountTrailingZeroBits(bits)]);
+    }
+    return ids;
+}
+
+std::size_t PhraseSolver::count(std::string_view pattern, std::uint32_t guessedLetters, int categoryId) const {
+    Bitmap rows;
+    const Group *group = match(pattern, guessedLetters, rows);
+    if (!group)
+        return 0;
+    keepCategory(*group, categoryId, rows);
+
+    std::size_t total = 0;
+    for (std::uint64_t bits : rows)
+        total += static_cast<std::size_t>(qPopulationCount(bits));
+    return total;
+}
+
+PhraseSolver::Candidates PhraseSolver::candidates(const PhraseBoard &board, int categoryId) const {
+    Candidates result;
+    const std::string pattern = patternOf(board);
+
+    Bitmap rows;
+    const Group *group = match(pattern, board.guessedMask(), rows);
+    if (!group)
+        return result;
+    keepCategory(*group, categoryId, rows);
+
+    // Candidate number of the first surviving row in each word
+    std::vector<std::size_t> rank(rows.size());
+    for (std::size_t i = 0; i < rows.size(); i++) {
+        rank[i] = result.ids.size();
+        for (std::uint64_t bits = rows[i]; bits; bits &= bits - 1)
+            result.ids.push_back(group->ids[i * 64 + qCountTrailingZeroBits(bits)]);
+    }
+
+    std::vector<std::size_t> hidden;
+    for (std::size_t cell = 0; cell < group->cells.size(); cell++) {
+        if (pattern[group->cells[cell]] == '_')
+            hidden.push_back(cell);
+    }
+    result.hiddenCells = hidden.size();
+    result.letters.assign(result.ids.size() * hidden.size(), 0);
+
+    // Each (cell, letter) bitmap AND the surviving rows says which candidates have that letter there
+    for (std::size_t h = 0; h < hidden.size(); h++) {
+        const std::size_t cell = hidden[h];
+        for (std::uint32_t letters = group->cellLetters[cell]; letters; letters &= letters - 1) {
+            const int letter = qCountTrailingZeroBits(letters);
+            const std::uint64_t *bitmap = group->cellBitmap(cell, letter);
+            for (std::size_t i = 0; i < rows.size(); i++) {
+                for (std::uint64_t bits = bitmap[i] & rows[i]; bits; bits &= bits - 1) {
+                    const std::uint64_t below = rows[i] & ((std::uint64_t(1) << qCountTrailingZeroBits(bits)) - 1);
+                    const std::size_t candidate = rank[i] + qPopulationCount(below);
+                    result.letters[candidate * hidden.size() + h] = static_cast<std::uint8_t>(letter);
+                }
+            }
+        }
+    }
+    return result;
+}
@@ -0,0 +1,77 @@
+#ifndef PHRASESOLVER_H
+#define PHRASESOLVER_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class PhraseBoard;
+class PhraseLibrary;
+
+// Finds every phrase of a library that is consistent with a partially revealed board.
+// Phrases are grouped by shape (the phrase with every letter replaced by '_', so word lengths
+// and punctuation must match). Within a group every letter cell has one bitmap per letter
+// occurring there, and a board is matched by AND-ing those bitmaps, never by comparing text.
+class PhraseSolver {
+public:
+    // The consistent phrases of a board together with their letters in its hidden cells
+    struct Candidates {
+        std::vector<std::uint32_t> ids;
+        std::size_t hiddenCells = 0;
+        std::vector<std::uint8_t> letters;  // one row of hiddenCells letters per id, 0 = 'A'
+    };
+
+    void build(const PhraseLibrary &library);
+
+    // Ids of all phrases consistent with the board, in ascending order. A phrase matches when
+    // it shows the same letters in the revealed cells and none of the guessed letters in a
+    // hidden cell. categoryId < 0 accepts every category.
+    std::vector<std::uint32_t> solve(const PhraseBoard &board, int categoryId = -1) const;
+
+    // Same, for a pattern such as "_O_'_ _O_ _O___ _____" ('_' = hidden letter) and a mask
+    // of the guessed letters (bit 0 = 'A')
+    std::vector<std::uint32_t> solve(std::string_view pattern, std::uint32_t guessedLetters,
+                                     int categoryId = -1) const;
+
+    // Number of consistent phrases, without listing them
+    std::size_t count(std::string_view pattern, std::uint32_t guessedLetters, int categoryId = -1) const;
+
+    // Consistent phrases with their hidden letters, read from the cell bitmaps
+    Candidates candidates(const PhraseBoard &board, int categoryId = -1) const;
+
+private:
+    using Bitmap = std::vector<std::uint64_t>;
+
+    struct Group {
+        std::vector<std::uint16_t> cells;   // character position of each letter cell
+        std::vector<std::uint32_t> ids;     // phrase id of each row
+        std::vector<std::uint16_t> categories;
+        std::size_t words = 0;              // 64-bit words per bitmap
+
+        // Only letters that occur in a cell get a bitmap. The bitmap of letter l in cell c is
+        // number base[c] + popcount(cellLetters[c] below l), the bitmaps of the letters
+        // occurring anywhere in the phrase follow from presentBase on.
+        std::vector<std::uint32_t> cellLetters;
+        std::vector<std::uint32_t> base;
+        std::uint32_t groupLetters = 0;
+        std::uint32_t presentBase = 0;
+        std::vector<std::uint64_t> bitmaps;
+
+        std::size_t cellOffset(std::size_t cell, int letter) const;
+        std::size_t presentOffset(int letter) const;
+        const std::uint64_t *cellBitmap(std::size_t cell, int letter) const { return bitmaps.data() + cellOffset(cell, letter); }
+        const std::uint64_t *presentBitmap(int letter) const { return bitmaps.data() + presentOffset(letter); }
+    };
+
+    static std::string shapeOf(std::string_view text);
+    static std::string patternOf(const PhraseBoard &board);
+    const Group *match(std::string_view pattern, std::uint32_t guessedLetters, Bitmap &rows) const;
+    static void keepCategory(const Group &group, int categoryId, Bitmap &rows);
+
+    std::unordered_map<std::string, std::uint32_t> shapes;  // shape -> group
+    std::vector<Group> groups;
+};
+
+#endif // PHRASESOLVER_H
@@ -0,0 +1,22 @@
+#ifndef PHRASEVIEW_H
+#define PHRASEVIEW_H
+
+#include <array>
+#include <memory>
+#include <string_view>
+
+// Lightweight view of a phrase served by the PhraseLibrary.
+// The referenced text stays valid for as long as the library that returned it, or for as
+// long as this view when its storage can be released earlier (e.g. an evicted shard).
+struct PhraseView {
+    std::string_view text;
+    std::string_view category;
+    int id = -1;          // library-wide phrase id, see PhraseLibrary::phrase(int)
+    int categoryId = -1;  // library-wide category id, see PhraseLibrary::categoryName
+    std::array<std::string_view, 3> hints;
+    int hintCount = 0;
+
+    std::shared_ptr<const void> owner;  // keeps the storage behind the views alive, may be null
+};
+
+#endif // PHRASEVIEW_H
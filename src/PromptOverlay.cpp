@@ -0,0 +1,156 @@
+// This file implements the overlay prompts of the game screen
+
+#include "PromptOverlay.h"
+
+#include <QEvent>
+#include <QHBoxLayout>
+#include <QKeyEvent>
+#include <QPainter>
+#include <QVBoxLayout>
+
+PromptOverlay::PromptOverlay(QWidget *parent)
+    : QWidget(parent)
+{
+    // Follows the size of the parent, see eventFilter
+    parent->installEventFilter(this);
+    setGeometry(parent->rect());
+    hide();
+
+    panel = new QWidget(this);
+    panel->setObjectName("promptPanel");
+    panel->setFixedWidth(420);
+    panel->setStyleSheet(
+        "#promptPanel {"
+        "background-color: #FFE3F8;"
+        "border: 4px solid #5C1F53;"
+        "border-radius: 10px;"
+        "}"
+        );
+
+    titleLabel = new QLabel(panel);
+    titleLabel->setAlignment(Qt::AlignCenter);
+    titleLabel->setStyleSheet("font-size: 20px; color: #8F0774; font-weight: bold;");
+
+    messageLabel = new QLabel(panel);
+    messageLabel->setAlignment(Qt::AlignCenter);
+    messageLabel->setWordWrap(true);
+    messageLabel->setStyleSheet("font-size: 15px; color: #5C1F53;");
+
+    input = new QLineEdit(panel);
+    input->setStyleSheet("font-size: 15px;");
+
+    acceptButton = new QPushButton(panel);
+    rejectButton = new QPushButton(panel);
+    for (QPushButton *button : { acceptButton, rejectButton }) {
+        button->setFixedSize(145, 36);
+        button->setStyleSheet(
+            "background-color: #5C1F53;"
+            "color: white;"
+            "font-family: Verdana;"
+            "font-size: 12px;"
+            "border-radius: 5px;"
+            );
+    }
+    connect(acceptButton, &QPushButton::clicked, this, [this]() { finish(true); });
+    connect(rejectButton, &QPushButton::clicked, this, [this]() { finish(false); });
+
+    QHBoxLayout *buttons = new QHBoxLayout();
+    buttons->addStretch();
+    buttons->addWidget(acceptButton);
+    buttons->addWidget(rejectButton);
+    buttons->addStretch();
+    buttons->setSpacing(15);
+
+    QVBoxLayout *panelLayout = new QVBoxLayout(panel);
+    panelLayout->addWidget(titleLabel);
+    panelLayout->addWidget(messageLabel);
+    panelLayout->addWidget(input);
+    panelLayout->addSpacing(5);
+    panelLayout->addLayout(buttons);
+    panelLayout->setContentsMargins(20, 15, 20, 15);
+    panelLayout->setSpacing(10);
+
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->addWidget(panel, 0, Qt::AlignCenter);
+    setLayout(layout);
+}
+
+void PromptOverlay::ask(const QString &title, const QString &message, const QString &acceptLabel,
+                        const QString &rejectLabel, Answer answer) {
+    open(title, message, acceptLabel, rejectLabel, false, std::move(answer));
+}
+
+void PromptOverlay::askText(const QString &title, const QString &message, const QString &acceptLabel,
+                            const QString &rejectLabel, Answer answer) {
+    open(title, message, acceptLabel, rejectLabel, true, std::move(answer));
+}
+
+void PromptOverlay::open(const QString &title, const QString &message, const QString &acceptLabel,
+                         const QString &rejectLabel, bool withInput, Answer answer) {
+    pending = std::move(answer);
+
+    titleLabel->setText(title);
+    messageLabel->setText(message);
+    input->clear();
+    input->setVisible(withInput);
+    acceptButton->setText(acceptLabel);
+    rejectButton->setText(rejectLabel);
+    rejectButton->setVisible(!rejectLabel.isEmpty());
+
+    setGeometry(parentWidget()->rect());
+    raise();
+    show();
+    if (withInput)
+        input->setFocus();
+    else
+        acceptButton->setFocus();
+}
+
+void PromptOverlay::dismiss() {
+    pending = nullptr;
+    hide();
+}
+
+// The prompt is closed before its answer runs, so the answer may ask the next question
+void PromptOverlay::finish(bool accepted) {
+    if (!isVisible())
+        return;
+
+    const Answer answer = std::move(pending);
+    pending = nullptr;
+    const QString text = input->isVisible() ? input->text() : QString();
+    hide();
+
+    if (answer)
+        answer(accepted || rejectButton->isHidden(), text);
+}
+
+// Enter accepts and Escape rejects, also while the input has the focus
+void PromptOverlay::keyPressEvent(QKeyEvent *event) {
+    switch (event->key()) {
+    case Qt::Key_Return:
+    case Qt::Key_Enter:
+        finish(true);
+        break;
+    case Qt::Key_Escape:
+        finish(false);
+        break;
+    default:
+        QWidget::keyPressEvent(event);
+        break;
+    }
+}
+
+// Dims the screen underneath
+void PromptOverlay::paintEvent(QPaintEvent *event) {
+    QPainter painter(this);
+    painter.fillRect(rect(), QColor(40, 10, 35, 140));
+
+    QWidget::paintEvent(event);
+}
+
+bool PromptOverlay::eventFilter(QObject *watched, QEvent *event) {
+    if (watched == parentWidget() && event->type() == QEvent::Resize)
+        setGeometry(parentWidget()->rect());
+    return QWidget::eventFilter(watched, event);
+}
@@ -0,0 +1,55 @@
+#ifndef PROMPTOVERLAY_H
+#define PROMPTOVERLAY_H
+
+#include <QLabel>
+#include <QLineEdit>
+#include <QPushButton>
+#include <QWidget>
+
+#include <functional>
+
+// A question drawn over its parent widget instead of a modal dialog. ask() returns at once and
+// the answer arrives later through the callback, so no handler waits in a nested event loop.
+// The overlay covers the whole parent, which keeps clicks away from the screen underneath.
+// There is at most one question at a time: asking again replaces the open one, whose callback
+// is then never called.
+class PromptOverlay : public QWidget {
+    Q_OBJECT
+
+public:
+    // accepted is false for the reject button and Escape; text is the input of askText()
+    using Answer = std::function<void(bool accepted, const QString &text)>;
+
+    explicit PromptOverlay(QWidget *parent);
+
+    // An empty reject label shows a single button
+    void ask(const QString &title, const QString &message, const QString &acceptLabel,
+             const QString &rejectLabel, Answer answer);
+    void askText(const QString &title, const QString &message, const QString &acceptLabel,
+                 const QString &rejectLabel, Answer answer);
+
+    // Hides the open question without answering it
+    void dismiss();
+
+    bool isOpen() const { return isVisible(); }
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+    void keyPressEvent(QKeyEvent *event) override;
+    bool eventFilter(QObject *watched, QEvent *event) override;
+
+private:
+    void open(const QString &title, const QString &message, const QString &acceptLabel,
+              const QString &rejectLabel, bool withInput, Answer answer);
+    void finish(bool accepted);
+
+    QWidget *panel;
+    QLabel *titleLabel;
+    QLabel *messageLabel;
+    QLineEdit *input;
+    QPushButton *acceptButton;
+    QPushButton *rejectButton;
+    Answer pending;
+};
+
+#endif // PROMPTOVERLAY_H
@@ -0,0 +1,65 @@
+// This file implements the seedable random number generator used by game sessions and tools
+
+#include "Random.h"
+
+#include <chrono>
+#include <random>
+
+// SplitMix64 step, spreads a seed over the generator state
+static std::uint64_t splitMix(std::uint64_t &value) {
+    std::uint64_t z = (value += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+Random::Random(std::uint64_t seed) {
+    for (std::uint64_t &word : state)
+        word = splitMix(seed);
+}
+
+Random Random::stream(std::uint64_t seed, std::uint64_t stream) {
+    std::uint64_t mixed = seed;
+    const std::uint64_t seedHash = splitMix(mixed);
+    mixed = stream ^ seedHash;
+    return Random(splitMix(mixed) ^ seed);
+}
+
+std::uint64_t Random::freshSeed() {
+    std::random_device device;
+    std::uint64_t seed = (std::uint64_t(device()) << 32) ^ device();
+    seed ^= static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    return splitMix(seed);
+}
+
+std::uint32_t Random::bounded(std::uint32_t range) {
+    std::uint64_t product = (next() >> 32) * range;
+    std::uint32_t low = static_cast<std::uint32_t>(product);
+    if (low < range) {
+        // Reject the few values that would make some results more likely than others
+        const std::uint32_t threshold = (0u - range) % range;
+        while (low < threshold) {
+            product = (next() >> 32) * range;
+            low = static_cast<std::uint32_t>(product);
+        }
+    }
+    return static_cast<std::uint32_t>(product >> 32);
+}
+
+void Random::jump() {
+    static const std::uint64_t polynomial[] = { 0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull,
+                                                0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull };
+
+    std::uint64_t jumped[4] = { 0, 0, 0, 0 };
+    for (std::uint64_t word : polynomial) {
+        for (int bit = 0; bit < 64; bit++) {
+            if (word & (std::uint64_t(1) << bit)) {
+                for (int i = 0; i < 4; i++)
+                    jumped[i] ^= state[i];
+            }
+            next();
+        }
+    }
+    for (int i = 0; i < 4; i++)
+        state[i] = jumped[i];
+}
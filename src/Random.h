@@ -0,0 +1,63 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cstdint>
+#include <limits>
+
+// Seedable random number generator (xoshiro256**), one per game session or worker thread.
+// The same seed always gives the same sequence on every platform, which is what replays and
+// simulation runs rely on. Meets the UniformRandomBitGenerator requirements.
+class Random {
+public:
+    using result_type = std::uint64_t;
+
+    // The state is expanded from the seed with SplitMix64, any seed (including 0) is fine
+    explicit Random(std::uint64_t seed = 0);
+
+    // Generator for stream number `stream` of a seed, e.g. one per simulated game. Streams
+    // of the same seed are independent of each other.
+    static Random stream(std::uint64_t seed, std::uint64_t stream);
+
+    // Non-deterministic seed for sessions that are not replaying anything
+    static std::uint64_t freshSeed();
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+    result_type operator()() { return next(); }
+
+    std::uint64_t next() {
+        const std::uint64_t result = rotate(state[1] * 5, 7) * 9;
+        const std::uint64_t shifted = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= shifted;
+        state[3] = rotate(state[3], 45);
+        return result;
+    }
+
+    // Uniform in [0, range) without modulo bias (Lemire's multiply-and-reject), 0 if range is 0
+    std::uint32_t bounded(std::uint32_t range);
+
+    // Uniform in [0, 1) with 53 bits of precision
+    double uniform() { return static_cast<double>(next() >> 11) * (1.0 / 9007199254740992.0); }
+
+    bool chance(double probability) { return uniform() < probability; }
+
+    // New generator seeded from this one's output, for handing to another thread or component
+    Random split() { return Random(next()); }
+
+    // Advances by 2^128 steps: calling jump() k times on copies of one generator gives k
+    // non-overlapping substreams
+    void jump();
+
+private:
+    static std::uint64_t rotate(std::uint64_t value, int bits) {
+        return (value << bits) | (value >> (64 - bits));
+    }
+
+    std::uint64_t state[4];
+};
+
+#endif // RANDOM_H
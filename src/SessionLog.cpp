@@ -0,0 +1,349 @@
+// This file writes game sessions to an append-only binary log and replays them headlessly
+
+#include "SessionLog.h"
+
+#include <cstring>
+#include <utility>
+
+using namespace SessionLogFormat;
+
+SessionLogWriter::SessionLogWriter(const std::string &path, const GameRules &rules, std::uint64_t seed)
+    : file(std::fopen(path.c_str(), "wb"))
+{
+    if (!file)
+        return;
+
+    buffer.reserve(flushThreshold + 1024);
+    buffer.insert(buffer.end(), magic, magic + sizeof(magic));
+    writeUnsigned(version);
+    writeUnsigned(seed);
+
+    writeSigned(rules.startingGems);
+    writeSigned(rules.vowelCost);
+    writeSigned(rules.hintCost);
+    writeSigned(rules.maxHints);
+    writeSigned(rules.easySeconds);
+    writeSigned(rules.hardSeconds);
+    writeSigned(rules.wrongSolvePenaltySeconds);
+
+    writeUnsigned(rules.wheel.segments().size());
+    for (const WheelSegment &segment : rules.wheel.segments()) {
+        writeString(segment.label);
+        std::uint64_t bits;
+        std::memcpy(&bits, &segment.weight, sizeof(bits));
+        writeUnsigned(bits);
+    }
+    flush();
+}
+
+SessionLogWriter::~SessionLogWriter() {
+    flush();
+    if (file)
+        std::fclose(file);
+}
+
+void SessionLogWriter::writeUnsigned(std::uint64_t value) {
+    while (value >= 0x80) {
+        buffer.push_back(static_cast<std::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<std::uint8_t>(value));
+}
+
+void SessionLogWriter::writeSigned(std::int64_t value) {
+    writeUnsigned((static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+}
+
+void SessionLogWriter::writeString(std::string_view text) {
+    writeUnsigned(text.size());
+    buffer.insert(buffer.end(), text.begin(), text.end());
+}
+
+void SessionLogWriter::endRecord() {
+    if (buffer.size() >= flushThreshold)
+        flush();
+}
+
+void SessionLogWriter::flush() {
+    if (!file || buffer.empty())
+        return;
+    std::fwrite(buffer.data(), 1, buffer.size(), file);
+    std::fflush(file);
+    buffer.clear();
+}
+
+void SessionLogWriter::start(int difficulty, const GameSession::Phrase &phrase) {
+    if (!file)
+        return;
+    writeByte(Start);
+    writeUnsigned(static_cast<std::uint64_t>(difficulty));
+    writeSigned(phrase.id);
+    writeSigned(phrase.categoryId);
+    writeString(phrase.text);
+    writeUnsigned(phrase.hints.size());
+    for (const std::string &hint : phrase.hints)
+        writeString(hint);
+    endRecord();
+}
+
+void SessionLogWriter::spin(GameSession::Result result, int segment) {
+    if (!file)
+        return;
+    writeByte(Spin);
+    writeByte(static_cast<std::uint8_t>(result));
+    writeSigned(segment);
+    endRecord();
+}
+
+void SessionLogWriter::consonant(char letter, GameSession::Result result) {
+    if (!file)
+        return;
+    writeByte(Consonant);
+    writeByte(static_cast<std::uint8_t>(letter));
+    writeByte(static_cast<std::uint8_t>(result));
+    endRecord();
+}
+
+void SessionLogWriter::vowel(char letter, GameSession::Result result) {
+    if (!file)
+        return;
+    writeByte(Vowel);
+    writeByte(static_cast<std::uint8_t>(letter));
+    writeByte(static_cast<std::uint8_t>(result));
+    endRecord();
+}
+
+void SessionLogWriter::hint(GameSession::Result result) {
+    if (!file)
+        return;
+    writeByte(Hint);
+    writeByte(static_cast<std::uint8_t>(result));
+    endRecord();
+}
+
+void SessionLogWriter::solve(std::string_view guess, GameSession::Result result) {
+    if (!file)
+        return;
+    writeByte(Solve);
+    writeString(guess);
+    writeByte(static_cast<std::uint8_t>(result));
+    endRecord();
+}
+
+void SessionLogWriter::tick(std::int64_t elapsedMillis) {
+    if (!file)
+        return;
+    writeByte(Tick);
+    writeSigned(elapsedMillis);
+    endRecord();
+}
+
+namespace {
+
+// Bounds-checked decoding; once a read runs past the end every later read fails too
+class LogReader {
+public:
+    LogReader(const std::uint8_t *data, std::size_t size) : position(data), end(data + size) {}
+
+    bool ok() const { return valid; }
+    bool atEnd() const { return position >= end; }
+
+    std::uint8_t readByte() {
+        if (position >= end) {
+            valid = false;
+            return 0;
+        }
+        return *position++;
+    }
+
+    std::uint64_t readUnsigned() {
+        std::uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            const std::uint8_t byte = readByte();
+            value |= std::uint64_t(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+                return value;
+        }
+        valid = false;
+        return 0;
+    }
+
+    std::int64_t readSigned() {
+        const std::uint64_t value = readUnsigned();
+        return static_cast<std::int64_t>((value >> 1) ^ (~(value & 1) + 1));
+    }
+
+    std::string_view readString() {
+        const std::uint64_t length = readUnsigned();
+        if (!valid || length > static_cast<std::uint64_t>(end - position)) {
+            valid = false;
+            return {};
+        }
+        const std::string_view text(reinterpret_cast<const char *>(position), static_cast<std::size_t>(length));
+        position += length;
+        return text;
+    }
+
+private:
+    const std::uint8_t *position;
+    const std::uint8_t *end;
+    bool valid = true;
+};
+
+GameSession::Result readResult(LogReader &in) {
+    return static_cast<GameSession::Result>(in.readByte());
+}
+
+} // namespace
+
+ReplayReport SessionReplay::replay(const std::uint8_t *data, std::size_t size, const RoundCallback &onRoundEnd) {
+    ReplayReport report;
+    LogReader in(data, size);
+
+    if (size < sizeof(magic) || std::memcmp(data, magic, sizeof(magic)) != 0) {
+        report.error = "not a session log";
+        return report;
+    }
+    for (std::size_t i = 0; i < sizeof(magic); i++)
+        in.readByte();
+    if (in.readUnsigned() != version) {
+        report.error = "unsupported session log version";
+        return report;
+    }
+    report.seed = in.readUnsigned();
+
+    // The rules the session was played under
+    GameRules rules;
+    rules.startingGems = static_cast<int>(in.readSigned());
+    rules.vowelCost = static_cast<int>(in.readSigned());
+    rules.hintCost = static_cast<int>(in.readSigned());
+    rules.maxHints = static_cast<int>(in.readSigned());
+    rules.easySeconds = static_cast<int>(in.readSigned());
+    rules.hardSeconds = static_cast<int>(in.readSigned());
+    rules.wrongSolvePenaltySeconds = static_cast<int>(in.readSigned());
+
+    std::vector<WheelSegment> segments(static_cast<std::size_t>(in.readUnsigned() & 0xFFFF));
+    for (WheelSegment &segment : segments) {
+        const std::string label(in.readString());
+        const std::uint64_t bits = in.readUnsigned();
+        if (!in.ok() || !WheelSegment::parse(label, segment)) {
+            report.error = "invalid wheel in session log header";
+            return report;
+        }
+        std::memcpy(&segment.weight, &bits, sizeof(bits));
+    }
+    rules.wheel = WheelDefinition(std::move(segments));
+    if (!in.ok()) {
+        report.error = "truncated session log header";
+        return report;
+    }
+
+    GameSession session(rules, report.seed);
+    GameSession::Phrase phrase;
+
+    while (!in.atEnd()) {
+        const bool wasOver = session.isOver();
+        bool matched = true;
+
+        switch (in.readByte()) {
+        case Start: {
+            const int difficulty = static_cast<int>(in.readUnsigned());
+            phrase.id = static_cast<int>(in.readSigned());
+            phrase.categoryId = static_cast<int>(in.readSigned());
+            phrase.text.assign(in.readString());
+            phrase.hints.resize(static_cast<std::size_t>(in.readUnsigned() & 0xFF));
+            for (std::string &hint : phrase.hints)
+                hint.assign(in.readString());
+            if (in.ok()) {
+                session.start(difficulty, phrase);
+                report.rounds++;
+            }
+            break;
+        }
+        case Spin: {
+            const GameSession::Result expected = readResult(in);
+            const int segment = static_cast<int>(in.readSigned());
+            if (in.ok()) {
+                const GameSession::Result result = session.spin();
+                matched = result == expected && (result != GameSession::Result::Ok || session.pendingSegment() == segment);
+            }
+            break;
+        }
+        case Consonant: {
+            const char letter = static_cast<char>(in.readByte());
+            const GameSession::Result expected = readResult(in);
+            if (in.ok())
+                matched = session.guessConsonant(letter) == expected;
+            break;
+        }
+        case Vowel: {
+            const char letter = static_cast<char>(in.readByte());
+            const GameSession::Result expected = readResult(in);
+            if (in.ok())
+                matched = session.buyVowel(letter) == expected;
+            break;
+        }
+        case Hint: {
+            const GameSession::Result expected = readResult(in);
+            if (in.ok())
+                matched = session.buyHint() == expected;
+            break;
+        }
+        case Solve: {
+            const std::string_view guess = in.readString();
+            const GameSession::Result expected = readResult(in);
+            if (in.ok())
+                matched = session.solve(guess) == expected;
+            break;
+        }
+        case Tick: {
+            const std::int64_t elapsed = in.readSigned();
+            if (in.ok())
+                session.tick(elapsed);
+            break;
+        }
+        default:
+            report.error = "unknown record type";
+            break;
+        }
+
+        // A crash while the log was written can cut the last record short
+        if (!in.ok()) {
+            report.error = "truncated record";
+            break;
+        }
+        if (!report.error.empty())
+            break;
+
+        report.records++;
+        if (!matched)
+            report.mismatches++;
+        if (!wasOver && session.isOver()) {
+            if (session.phase() == GameSession::Phase::Won)
+                report.wins++;
+            if (onRoundEnd)
+                onRoundEnd(session);
+        }
+    }
+
+    report.phase = session.phase();
+    report.gems = session.gems();
+    report.remainingMillis = session.remainingMillis();
+    return report;
+}
+
+bool SessionReplay::readFile(const std::string &path, std::vector<std::uint8_t> &data) {
+    std::FILE *file = std::fopen(path.c_str(), "rb");
+    if (!file)
+        return false;
+
+    data.clear();
+    std::uint8_t chunk[64 * 1024];
+    std::size_t read;
+    while ((read = std::fread(chunk, 1, sizeof(chunk), file)) > 0)
+        data.insert(data.end(), chunk, chunk + read);
+
+    const bool ok = !std::ferror(file);
+    std::fclose(file);
+    return ok;
+}
@@ -0,0 +1,107 @@
+#ifndef SESSIONLOG_H
+#define SESSIONLOG_H
+
+#include "GameRules.h"
+#include "GameSession.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+ * Append-only binary log of a game session (see tools/replay).
+ *
+ *   header   magic "SSLG", version, session seed, the game rules and wheel slices
+ *   records  one per command: type byte, then its arguments and the result it had
+ *
+ * Integers are LEB128 varints (zigzag for signed values), strings are a varint length
+ * followed by the bytes, weights are the bits of an IEEE double. A round starts with a
+ * Start record holding its phrase, so a log replays without the phrase library and with the
+ * exact rules it was played under. Refused commands are recorded too; replaying one must
+ * be refused in the same way.
+ */
+namespace SessionLogFormat {
+
+const char magic[4] = { 'S', 'S', 'L', 'G' };
+const std::uint32_t version = 1;
+
+enum Record : std::uint8_t {
+    Start = 1,      // difficulty, phrase id, category id, text, hint count, hints
+    Spin = 2,       // result, segment
+    Consonant = 3,  // letter, result
+    Vowel = 4,      // letter, result
+    Hint = 5,       // result
+    Solve = 6,      // guess, result
+    Tick = 7        // elapsed milliseconds
+};
+
+} // namespace SessionLogFormat
+
+// Records the commands of a GameSession. Records are encoded into a memory buffer, which
+// costs a few byte stores per command; the buffer goes to disk when it fills up, when a round
+// ends and when the writer is destroyed.
+class SessionLogWriter {
+public:
+    SessionLogWriter(const std::string &path, const GameRules &rules, std::uint64_t seed);
+    ~SessionLogWriter();
+
+    SessionLogWriter(const SessionLogWriter &) = delete;
+    SessionLogWriter &operator=(const SessionLogWriter &) = delete;
+
+    bool isOpen() const { return file != nullptr; }
+
+    void start(int difficulty, const GameSession::Phrase &phrase);
+    void spin(GameSession::Result result, int segment);
+    void consonant(char letter, GameSession::Result result);
+    void vowel(char letter, GameSession::Result result);
+    void hint(GameSession::Result result);
+    void solve(std::string_view guess, GameSession::Result result);
+    void tick(std::int64_t elapsedMillis);
+
+    void flush();
+
+private:
+    static const std::size_t flushThreshold = 64 * 1024;
+
+    void writeByte(std::uint8_t value) { buffer.push_back(value); }
+    void writeUnsigned(std::uint64_t value);
+    void writeSigned(std::int64_t value);
+    void writeString(std::string_view text);
+    void endRecord();
+
+    std::FILE *file = nullptr;
+    std::vector<std::uint8_t> buffer;
+};
+
+// Outcome of replaying a log
+struct ReplayReport {
+    std::uint64_t records = 0;
+    std::uint64_t rounds = 0;
+    std::uint64_t wins = 0;
+    std::uint64_t mismatches = 0;  // commands whose result or spin differs from the log
+    std::uint64_t seed = 0;
+    std::string error;             // empty if the whole log could be read
+
+    // State at the end of the log
+    GameSession::Phase phase = GameSession::Phase::Lost;
+    int gems = 0;
+    std::int64_t remainingMillis = 0;
+};
+
+// Re-drives GameSession from a log, without UI or timers: ticks are applied as recorded,
+// spins are decided by the session's generator from the logged seed and checked against
+// the logged segments. Round ends are reported to onRoundEnd, if given.
+class SessionReplay {
+public:
+    using RoundCallback = std::function<void(const GameSession &session)>;
+
+    static ReplayReport replay(const std::uint8_t *data, std::size_t size,
+                               const RoundCallback &onRoundEnd = RoundCallback());
+
+    static bool readFile(const std::string &path, std::vector<std::uint8_t> &data);
+};
+
+#endif // SESSIONLOG_H
@@ -0,0 +1,166 @@
+// This file streams phrases from a directory of phrase pack shards with a bounded cache
+
+#include "ShardedPhraseSource.h"
+
+#include <QDebug>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace PhrasePackFormat;
+
+// Reads every shard header in the directory, no shard is mapped yet
+bool ShardedPhraseSource::open(const QString &directory, qint64 maxResidentBytes) {
+    shards.clear();
+    categories = StringArena();
+    firstIndex[0].clear();
+    firstIndex[1].clear();
+    this->maxResidentBytes = maxResidentBytes;
+    packFlags = 0;
+
+    const QStringList files = QDir(directory).entryList(QStringList() << "*.pack", QDir::Files, QDir::Name);
+    std::uint64_t total[2] = { 0, 0 };
+
+    for (const QString &name : files) {
+        QFile file(QDir(directory).filePath(name));
+        PackHeader header;
+        if (!file.open(QIODevice::ReadOnly)
+            || file.read(reinterpret_cast<char *>(&header), sizeof(header)) != static_cast<qint64>(sizeof(header))
+            || std::memcmp(header.magic, magic, sizeof(magic)) != 0
+            || header.version != version
+            || header.easyCount > header.phraseCount
+            || (!shards.empty() && header.flags != packFlags)) {
+            qWarning() << "Skipping invalid phrase shard:" << file.fileName();
+            continue;
+        }
+
+        Shard shard;
+        if (!readCategories(file, header, shard)) {
+            qWarning() << "Skipping phrase shard with invalid categories:" << file.fileName();
+            continue;
+        }
+
+        packFlags = header.flags;
+        shard.path = file.fileName();
+        shard.bytes = file.size();
+        shard.count[0] = header.easyCount;
+        shard.count[1] = header.phraseCount - header.easyCount;
+
+        for (int difficulty = 0; difficulty < 2; difficulty++) {
+            firstIndex[difficulty].push_back(total[difficulty]);
+            total[difficulty] += shard.count[difficulty];
+        }
+        shards.push_back(shard);
+    }
+
+    // A final entry holding the totals makes every shard's range [first[i], first[i + 1])
+    firstIndex[0].push_back(total[0]);
+    firstIndex[1].push_back(total[1]);
+
+    return !shards.empty();
+}
+
+// Reads only the category table and names of a shard, the records stay on disk
+bool ShardedPhraseSource::readCategories(QFile &file, const PackHeader &header, Shard &shard) {
+    std::vector<PackString> table(header.categoryCount);
+    const qint64 tableBytes = static_cast<qint64>(table.size() * sizeof(PackString));
+    if (!file.seek(header.categoriesOffset)
+        || file.read(reinterpret_cast<char *>(table.data()), tableBytes) != tableBytes)
+        return false;
+
+    for (const PackString &entry : table) {
+        if (entry.offset + quint64(entry.length) > header.blobSize || !file.seek(header.blobOffset + qint64(entry.offset)))
+            return false;
+        const QByteArray name = file.read(entry.length);
+        if (name.size() != static_cast<int>(entry.length))
+            return false;
+        shard.categoryIds.push_back(categories.intern(std::string_view(name.constData(), name.size())));
+    }
+    return true;
+}
+
+int ShardedPhraseSource::size(int difficulty) const {
+    return shards.empty() ? 0 : static_cast<int>(firstIndex[difficulty].back());
+}
+
+// Finds the shard holding the phrase, then the record within that shard
+PhraseView ShardedPhraseSource::phrase(int difficulty, int index) const {
+    if (index < 0 || index >= size(difficulty))
+        return {};
+
+    QElapsedTimer timer;
+    timer.start();
+
+    const std::vector<std::uint64_t> &first = firstIndex[difficulty];
+    const int shard = static_cast<int>(std::upper_bound(first.begin(), first.end(), std::uint64_t(index)) - first.begin()) - 1;
+    const std::uint32_t local = static_cast<std::uint32_t>(index - first[shard]);
+
+    PhraseView view;
+    std::shared_ptr<const PhrasePack> pack = load(shard);
+    if (pack) {
+        view = pack->phrase(difficulty == 0 ? local : pack->easyCount() + local);
+        view.owner = pack;
+        if (view.categoryId >= 0 && view.categoryId < static_cast<int>(shards[shard].categoryIds.size())) {
+            view.categoryId = static_cast<int>(shards[shard].categoryIds[view.categoryId]);
+            view.category = categories.get(static_cast<std::uint32_t>(view.categoryId));
+        }
+    }
+
+    const double micros = timer.nsecsElapsed() / 1000.0;
+    std::lock_guard<std::mutex> lock(mutex);
+    draws++;
+    totalDrawMicros += micros;
+    maxDrawMicros = std::max(maxDrawMicros, micros);
+
+    return view;
+}
+
+// Returns a resident shard, mapping it and evicting the least recently used ones if needed
+std::shared_ptr<const PhrasePack> ShardedPhraseSource::load(int shard) const {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto found = resident.find(shard);
+    if (found != resident.end()) {
+        cacheHits++;
+        recentlyUsed.splice(recentlyUsed.begin(), recentlyUsed, found->second.position);
+        return found->second.pack;
+    }
+
+    auto pack = std::make_shared<PhrasePack>();
+    if (!pack->open(shards[shard].path))
+        return nullptr;
+    shardLoads++;
+
+    // Always keep the shard being loaded, even if it alone exceeds the budget
+    while (!recentlyUsed.empty() && residentBytes + shards[shard].bytes > maxResidentBytes) {
+        const int evicted = recentlyUsed.back();
+        recentlyUsed.pop_back();
+        resident.erase(evicted);
+        residentBytes -= shards[evicted].bytes;
+    }
+
+    recentlyUsed.push_front(shard);
+    resident[shard] = Resident{ pack, recentlyUsed.begin() };
+    residentBytes += shards[shard].bytes;
+
+    return pack;
+}
+
+ShardStats ShardedPhraseSource::stats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    ShardStats result;
+    result.shardCount = static_cast<int>(shards.size());
+    result.residentShards = static_cast<int>(resident.size());
+    result.residentBytes = residentBytes;
+    result.maxResidentBytes = maxResidentBytes;
+    result.shardLoads = shardLoads;
+    result.cacheHits = cacheHits;
+    result.draws = draws;
+    result.averageDrawMicros = draws ? totalDrawMicros / draws : 0.0;
+    result.maxDrawMicros = maxDrawMicros;
+    return result;
+}
@@ -0,0 +1,88 @@
+#ifndef SHARDEDPHRASESOURCE_H
+#define SHARDEDPHRASESOURCE_H
+
+#include "PhrasePack.h"
+#include "StringArena.h"
+
+#include <QString>
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Cache and latency figures for sizing the shard cache
+struct ShardStats {
+    int shardCount = 0;
+    int residentShards = 0;
+    qint64 residentBytes = 0;
+    qint64 maxResidentBytes = 0;
+    quint64 shardLoads = 0;   // cache misses that mapped a shard
+    quint64 cacheHits = 0;
+    quint64 draws = 0;
+    double averageDrawMicros = 0.0;
+    double maxDrawMicros = 0.0;
+};
+
+// Phrase corpus split over many phrase pack files in one directory. Only the shard headers
+// are read up front; shards are mapped on demand and a bounded LRU keeps the most recently
+// used ones resident. Phrases carry a reference to their shard, so evicting a shard never
+// invalidates a phrase that is still in use.
+//
+// The bound only holds for plain draws by difficulty. Everything derived from the whole
+// corpus (PhraseLibrary::scores(), index() and solver(), so filtered queries, scored packs,
+// the solver, the recommender and the simulator) reads every phrase once, mapping each shard
+// in turn through the cache, and keeps its result for every phrase in memory.
+class ShardedPhraseSource {
+public:
+    bool open(const QString &directory, qint64 maxResidentBytes);
+    bool isOpen() const { return !shards.empty(); }
+    std::uint32_t flags() const { return packFlags; }
+
+    // difficulty: 0 = easy, 1 = hard
+    int size(int difficulty) const;
+    PhraseView phrase(int difficulty, int index) const;
+
+    // Category names of all shards, interned into one arena with corpus-wide ids
+    int categoryCount() const { return static_cast<int>(categories.size()); }
+    std::string_view categoryName(int id) const { return categories.get(static_cast<std::uint32_t>(id)); }
+    int findCategory(std::string_view name) const { return categories.find(name); }
+
+    ShardStats stats() const;
+
+private:
+    struct Shard {
+        QString path;
+        qint64 bytes = 0;
+        std::uint32_t count[2] = { 0, 0 };
+        std::vector<std::uint32_t> categoryIds;  // shard category index -> corpus-wide id
+    };
+
+    struct Resident {
+        std::shared_ptr<const PhrasePack> pack;
+        std::list<int>::iterator position;
+    };
+
+    std::shared_ptr<const PhrasePack> load(int shard) const;
+    bool readCategories(QFile &file, const PhrasePackFormat::PackHeader &header, Shard &shard);
+
+    std::vector<Shard> shards;
+    StringArena categories;
+    std::vector<std::uint64_t> firstIndex[2];  // per difficulty, index of each shard's first phrase
+    qint64 maxResidentBytes = 0;
+    std::uint32_t packFlags = 0;
+
+    mutable std::mutex mutex;
+    mutable std::list<int> recentlyUsed;  // most recent first
+    mutable std::unordered_map<int, Resident> resident;
+    mutable qint64 residentBytes = 0;
+    mutable quint64 shardLoads = 0;
+    mutable quint64 cacheHits = 0;
+    mutable quint64 draws = 0;
+    mutable double totalDrawMicros = 0.0;
+    mutable double maxDrawMicros = 0.0;
+};
+
+#endif // SHARDEDPHRASESOURCE_H
@@ -0,0 +1,31 @@
+// This file deduplicates repeated strings such as categories and hints into a single buffer
+
+#include "StringArena.h"
+
+#include <functional>
+
+std::uint32_t StringArena::intern(std::string_view text) {
+    const int existing = find(text);
+    if (existing >= 0)
+        return static_cast<std::uint32_t>(existing);
+
+    const std::uint32_t id = static_cast<std::uint32_t>(refs.size());
+    refs.push_back(Ref{ static_cast<std::uint32_t>(data.size()), static_cast<std::uint32_t>(text.size()) });
+    data.append(text.data(), text.size());
+    ids.emplace(std::hash<std::string_view>()(text), id);
+    return id;
+}
+
+int StringArena::find(std::string_view text) const {
+    auto range = ids.equal_range(std::hash<std::string_view>()(text));
+    for (auto it = range.first; it != range.second; ++it) {
+        if (get(it->second) == text)
+            return static_cast<int>(it->second);
+    }
+    return -1;
+}
+
+std::string_view StringArena::get(std::uint32_t id) const {
+    const Ref &entry = refs[id];
+    return std::string_view(data.data() + entry.offset, entry.length);
+}
@@ -0,0 +1,38 @@
+#ifndef STRINGARENA_H
+#define STRINGARENA_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Interns strings into one contiguous buffer. Each distinct string is stored once and is
+// identified by a small integer id, or referenced by its offset/length in the buffer.
+class StringArena {
+public:
+    struct Ref {
+        std::uint32_t offset;
+        std::uint32_t length;
+    };
+
+    // Id of the string, adding it to the arena if it is new
+    std::uint32_t intern(std::string_view text);
+
+    // Id of the string, or -1 if it was never interned
+    int find(std::string_view text) const;
+
+    std::string_view get(std::uint32_t id) const;
+    const Ref &ref(std::uint32_t id) const { return refs[id]; }
+    std::size_t size() const { return refs.size(); }
+
+    // Every interned string back to back
+    const std::string &buffer() const { return data; }
+
+private:
+    std::string data;
+    std::vector<Ref> refs;
+    std::unordered_multimap<std::size_t, std::uint32_t> ids;  // string hash -> ids
+};
+
+#endif // STRINGARENA_H
@@ -1,24 +1,40 @@
 // This file handles the spinning wheel component in the game
 
 #include "Wheel.h"
+#include "AssetManager.h"
 
+#include <QDebug>
 #include <QGraphicsPixmapItem>
 #include <QVBoxLayout>
-#include <QRandomGenerator>
 #include <QMessageBox>
 #include <QtMath>
 #include <QPropertyAnimation>
+#include <QPainter>
+#include <QResizeEvent>
+#include <QShortcut>
+
+#include <algorithm>
+#include <cmath>
 
 /*
  * The Wheel class handles the visual spinning wheel component,
  * including its animation and the logic for determining which segment the wheel lands on.
  */
 
-Wheel::Wheel(QWidget *parent)
+// Speed for wheels created from now on, set from the command line
+Wheel::SpinSpeed Wheel::defaultSpeed = Wheel::NormalSpin;
+int Wheel::defaultTurboMillis = 600;
+
+Wheel::Wheel(const WheelDefinition &definition, Random random, QWidget *parent)
     : QWidget(parent),
     scene(new QGraphicsScene(this)),
-    view(new QGraphicsView(scene, this))
+    view(new WheelView(scene, this)),
+    definition(definition),
+    random(random),
+    speed(defaultSpeed),
+    turboMillis(defaultTurboMillis)
 {
+    setUpView();
     setUpWheelItem();
     setUpArrow();
 
@@ -32,93 +48,262 @@ Wheel::Wheel(QWidget *parent)
     animation->setEasingCurve(QEasingCurve::OutCubic);
 
     connect(animation, &QPropertyAnimation::finished, this, &Wheel::handleAnimationEnd);
+
+    // Only active while the wheel spins, so Space still presses buttons the rest of the time
+    skipShortcut = new QShortcut(QKeySequence(Qt::Key_Space), this);
+    skipShortcut->setContext(Qt::WindowShortcut);
+    skipShortcut->setEnabled(false);
+    connect(skipShortcut, &QShortcut::activated, this, &Wheel::stopSpin);
+    view->viewport()->installEventFilter(this);
+}
+
+// The view never transforms the scene: the pixmaps are already at their on-screen size, so a
+// frame only has to rotate one pixmap and repaint the area it covers
+void Wheel::setUpView() {
+    view->setRenderHint(QPainter::SmoothPixmapTransform);
+    view->setViewportUpdateMode(QGraphicsView::MinimalViewportUpdate);
+    view->setCacheMode(QGraphicsView::CacheBackground);
+    view->setOptimizationFlags(QGraphicsView::DontSavePainterState | QGraphicsView::DontAdjustForAntialiasing);
+    view->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    view->setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    view->setAlignment(Qt::AlignCenter);
 }
 
-// Loads the wheel image and positions it in the center of the screen
+// Loads the wheel image, it is scaled and positioned once the view has its size
 void Wheel::setUpWheelItem() {
-    QPixmap wheelPixmap(":/images/images/pink.png"); // corrected path from resources
-    wheelItem = new WheelItem(wheelPixmap);
+    // Wheels without a pre-drawn image get their slices drawn to match the definition
+    wheelSource = definition.image().isEmpty() ? drawWheel(definition) : AssetManager::pixmap(definition.image());
+    wheelItem = new WheelItem(wheelSource);
 
-    const double cx = wheelPixmap.width() / 2.0;
-    const double cy = wheelPixmap.height() / 2.0;
+    // Rotated every frame, so caching the item would only re-render the cache every frame
+    wheelItem->setTransformationMode(Qt::SmoothTransformation);
+    wheelItem->setCacheMode(QGraphicsItem::NoCache);
+    scene->addItem(wheelItem);
+}
 
-    // Set rotation origin to the center of the wheel
-    wheelItem->setTransformOriginPoint(cx, cy);
+// Scales the images to the device pixels of the view. The arrow keeps its place relative to
+// the wheel: half its image size, 130 px in from the left and 20 px above the wheel image.
+void Wheel::scaleToView() {
+    const QSize available = view->viewport()->size();
+    if (available.isEmpty() || available == scaledFor || wheelSource.isNull())
+        return;
+    scaledFor = available;
 
-    // Center the wheel in the scene
-    wheelItem->setPos(-cx, -cy);
+    const double sourceSize = wheelSource.width();
+    const double overhang = 20.0 / sourceSize;
+    const double diameter = std::min<double>(available.width(), available.height() / (1.0 + overhang));
+    const double factor = diameter / sourceSize;
+    const double ratio = devicePixelRatioF();
 
-    scene->addItem(wheelItem);
+    QPixmap wheelPixmap = wheelSource.scaled(QSize(qRound(diameter * ratio), qRound(diameter * ratio)),
+                                             Qt::KeepAspectRatio, Qt::SmoothTransformation);
+    wheelPixmap.setDevicePixelRatio(ratio);
+    wheelItem->setPixmap(wheelPixmap);
 
-    // Set the scene rect and view for proper display
-    scene->setSceneRect(-cx, -cy, wheelPixmap.width(), wheelPixmap.height());
-    view->fitInView(scene->sceneRect(), Qt::KeepAspectRatio);
-    view->setAlignment(Qt::AlignCenter);
-    view->scale(10, 10); // optional scaling factor
+    const double radius = diameter / 2.0;
+    wheelItem->setTransformOriginPoint(radius, radius);
+    wheelItem->setPos(-radius, -radius);
+
+    if (arrowItem && !arrowSource.isNull()) {
+        const QSizeF arrowSize = QSizeF(arrowSource.size()) * 0.5 * factor;
+        QPixmap arrowPixmap = arrowSource.scaled((arrowSize * ratio).toSize(), Qt::KeepAspectRatio,
+                                                 Qt::SmoothTransformation);
+        arrowPixmap.setDevicePixelRatio(ratio);
+        arrowItem->setPixmap(arrowPixmap);
+        arrowItem->setPos(-radius + 130 * factor, -radius - 20 * factor);
+    }
+
+    scene->setSceneRect(scene->itemsBoundingRect());
+    view->resetTransform();
+}
+
+void Wheel::resizeEvent(QResizeEvent *event) {
+    QWidget::resizeEvent(event);
+    scaleToView();
+}
+
+// Draws one slice per segment with its label, laid out the way WheelDefinition reads them:
+// slice i is centred (i + 1) slices clockwise from the top
+QPixmap Wheel::drawWheel(const WheelDefinition &definition) {
+    const int size = 400;
+    QPixmap pixmap(size, size);
+    pixmap.fill(Qt::transparent);
+
+    QPainter painter(&pixmap);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setRenderHint(QPainter::TextAntialiasing);
+
+    const QRectF bounds(2, 2, size - 4, size - 4);
+    const double slice = definition.sliceAngle();
+    const QColor colors[] = { QColor("#FFB7E6"), QColor("#FFE3F8"), QColor("#F48FD0"), QColor("#FFD1EE") };
+
+    for (int i = 0; i < definition.size(); i++) {
+        // Qt measures angles counter-clockwise from 3 o'clock
+        const double centre = (i + 1) * slice;
+        painter.setPen(QPen(QColor("#8F0774"), 2));
+        painter.setBrush(colors[i % 4]);
+        painter.drawPie(bounds, qRound((90.0 - centre - slice / 2.0) * 16), qRound(slice * 16));
+
+        painter.save();
+        painter.translate(size / 2.0, size / 2.0);
+        painter.rotate(centre - 90.0);
+        painter.setPen(QColor("#8F0774"));
+        QFont font = painter.font();
+        font.setBold(true);
+        font.setPixelSize(qBound(9, qRound(slice / 2.5), 16));
+        painter.setFont(font);
+        painter.drawText(QRectF(40, -12, size / 2.0 - 50, 24), Qt::AlignRight | Qt::AlignVCenter,
+                         QString::fromStdString(definition.segment(i).label));
+        painter.restore();
+    }
+    return pixmap;
 }
 
 // Loads the arrow image that points to the resulting segment after the spin
 void Wheel::setUpArrow() {
-    QPixmap arrowPixmap(":/images/images/arrow.png"); // corrected path from resources
-    arrowItem = new QGraphicsPixmapItem(arrowPixmap);
+    arrowSource = AssetManager::pixmap(":/images/images/arrow.png"); // corrected path from resources
+    arrowItem = new QGraphicsPixmapItem(arrowSource);
 
-    arrowItem->setScale(0.5);
-    arrowItem->setPos(-scene->width() / 2 + 130, -scene->height() / 2 - 20);
+    // The arrow never moves, its cached rendering is reused for every frame of a spin
+    arrowItem->setTransformationMode(Qt::SmoothTransformation);
+    arrowItem->setCacheMode(QGraphicsItem::DeviceCoordinateCache);
+    arrowItem->setZValue(1);
 
     scene->addItem(arrowItem);
 }
 
 // Starts the spinning animation for the wheel
-void Wheel::spinWheel() {
-    if (isSpinning) return; // Prevent multiple spins
+void Wheel::spinTo(int segment) {
+    if (spinning || segment < 0 || segment >= definition.size()) return; // Prevent multiple spins
+
+    spinning = true;
 
-    isSpinning = true;
+    // The outcome is already known, the animation aims at a random spot inside its slice
+    targetSegment = segment;
+    const double landing = definition.landingAngle(targetSegment, random.uniform());
 
-    // Randomize the final wheel position
-    int fullRotations = 6; // number of full 360° rotations
-    int randomAngle = QRandomGenerator::global()->bounded(360); // random offset
+    double offset = std::fmod(landing - currentRotation, 360.0);
+    if (offset < 0.0)
+        offset += 360.0;
 
-    endAngle = currentRotation + 360 * fullRotations + randomAngle;
+    if (speed == InstantSpin) {
+        endAngle = currentRotation + offset;
+        finishSpin();
+        return;
+    }
+
+    // Number of full 360° rotations, fewer in turbo so the short spin stays readable
+    const int fullRotations = speed == TurboSpin ? 2 : 6;
+    endAngle = currentRotation + 360 * fullRotations + offset;
 
     // Configure animation
+    scaleToView();
+    view->startMeasuring();
+    skipShortcut->setEnabled(true);
     animation->setStartValue(currentRotation);
     animation->setEndValue(endAngle);
-    animation->setDuration(4000); // 4 seconds spin
+    animation->setDuration(speed == TurboSpin ? turboMillis : 4000); // 4 seconds spin
     animation->start();
 }
 
 // Handles logic after spin animation ends
 void Wheel::handleAnimationEnd() {
+    finishSpin();
+}
+
+// Puts the wheel at its end angle and reports the segment decided when the spin started
+void Wheel::finishSpin() {
+    wheelItem->setRotation(endAngle);
     currentRotation = fmod(endAngle, 360.0); // store last angle
-    isSpinning = false;
+    spinning = false;
+    skipShortcut->setEnabled(false);
+
+    // Instant spins draw no frames, there is nothing to report for them
+    if (view->isMeasuring()) {
+        view->stopMeasuring();
+        logFrameStats();
+    }
 
     // Emit the segment that the wheel landed on
-    emit landedSegment(calculateSegment(currentRotation));
+    emit landedSegment(targetSegment);
 }
 
 // Calculate which segment the wheel landed on based on the rotation angle
 int Wheel::calculateSegment(double angle) const {
-    const double arrowOffset = 45.0 / 2.0; // half segment offset
-
-    double adjusted = fmod(angle + arrowOffset, 360.0);
-    int index = static_cast<int>(adjusted / segmentAngle);
-
-    return numSegments - 1 - index;
+    return definition.segmentAt(angle);
 }
 
-// Stops the wheel mid-spin (if needed)
+// Stops the wheel mid-spin (if needed). The outcome does not depend on the animation, so the
+// wheel jumps to where it was going to land and the decided segment is reported right away.
 void Wheel::stopSpin() {
-    if (!isSpinning) return; // nothing to stop
+    if (!spinning) return; // nothing to stop
 
     if (animation && animation->state() == QAbstractAnimation::Running) {
         animation->stop(); // immediately stop animation
     }
 
-    isSpinning = false;
+    finishSpin();
+}
+
+// Skipping is the player's way of stopping: a click on the wheel or Space while it spins.
+// Clicks land on the view's viewport, which this widget filters.
+bool Wheel::eventFilter(QObject *watched, QEvent *event) {
+    if (watched == view->viewport() && event->type() == QEvent::MouseButtonPress && spinning) {
+        stopSpin();
+        return true;
+    }
+    return QWidget::eventFilter(watched, event);
+}
+
+void Wheel::setSpinSpeed(SpinSpeed speed, int turboMillis) {
+    this->speed = speed;
+    this->turboMillis = qMax(1, turboMillis);
+}
+
+void Wheel::setDefaultSpinSpeed(SpinSpeed speed, int turboMillis) {
+    defaultSpeed = speed;
+    defaultTurboMillis = qMax(1, turboMillis);
+}
+
+// Frames are only timed while the wheel spins, idle repaints would skew the numbers
+void WheelView::startMeasuring() {
+    renderTimes.clear();
+    frameIntervals.clear();
+    lastFrame = -1;
+    clock.start();
+    measuring = true;
+}
+
+void WheelView::paintEvent(QPaintEvent *event) {
+    if (!measuring) {
+        QGraphicsView::paintEvent(event);
+        return;
+    }
+
+    const qint64 start = clock.nsecsElapsed();
+    if (lastFrame >= 0)
+        frameIntervals.record(start - lastFrame);
+    lastFrame = start;
+
+    QGraphicsView::paintEvent(event);
+    renderTimes.record(clock.nsecsElapsed() - start);
+}
 
-    // Record current rotation for future spins
-    currentRotation = wheelItem->rotation();
+// One line per spin: how long painting took and how evenly the frames arrived. At 60 fps a
+// frame is due every 16.7 ms, intervals of 17 ms or more are frames that came late.
+void Wheel::logFrameStats() const {
+    const FrameStats &render = view->renderTimes;
+    const FrameStats &intervals = view->frameIntervals;
+    if (render.count() == 0)
+        return;
 
-    // Emit the segment the wheel stopped at
-    emit landedSegment(calculateSegment(currentRotation));
+    qInfo().noquote() << QString("Wheel spin: %1 frames, render avg %2 ms, p95 <%3 ms, max %4 ms; "
+                                 "interval p50 <%5 ms, p95 <%6 ms, %7 late")
+                             .arg(render.count())
+                             .arg(render.averageMillis(), 0, 'f', 2)
+                             .arg(render.percentileMillis(0.95))
+                             .arg(render.maxMillis(), 0, 'f', 2)
+                             .arg(intervals.percentileMillis(0.5))
+                             .arg(intervals.percentileMillis(0.95))
+                             .arg(intervals.framesFrom(17));
 }
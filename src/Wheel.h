@@ -1,12 +1,19 @@
 #ifndef WHEEL_H
 #define WHEEL_H
 
+#include "FrameStats.h"
+#include "Random.h"
+#include "WheelDefinition.h"
+
 #include <QWidget>
+#include <QElapsedTimer>
 #include <QGraphicsScene>
 #include <QGraphicsView>
 #include <QPropertyAnimation>
 #include <QGraphicsPixmapItem>
 
+class QShortcut;
+
 // Custom QGraphicsPixmapItem with rotation property for animation
 class WheelItem : public QObject, public QGraphicsPixmapItem {
     Q_OBJECT
@@ -17,43 +24,101 @@ public:
         : QGraphicsPixmapItem(pixmap) {}
 };
 
+// Graphics view that times its own repaints. Render time is the cost of one paint event,
+// the interval is the time since the previous one, which is what shows up as stutter.
+class WheelView : public QGraphicsView {
+public:
+    explicit WheelView(QGraphicsScene *scene, QWidget *parent = nullptr)
+        : QGraphicsView(scene, parent) {}
+
+    FrameStats renderTimes;
+    FrameStats frameIntervals;
+
+    void startMeasuring();
+    void stopMeasuring() { measuring = false; }
+    bool isMeasuring() const { return measuring; }
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+
+private:
+    QElapsedTimer clock;
+    qint64 lastFrame = -1;
+    bool measuring = false;
+};
+
 // Wheel widget containing the spinning wheel and arrow graphics
 class Wheel : public QWidget {
     Q_OBJECT
 
 public:
-    explicit Wheel(QWidget *parent = nullptr);
+    // Normal spins take 4 seconds, turbo spins a configurable fraction of that, instant spins
+    // report the segment without animating
+    enum SpinSpeed { NormalSpin, TurboSpin, InstantSpin };
 
-    void spinWheel();
+    // The generator only places the pointer inside the landed slice, outcomes come from the
+    // GameSession
+    explicit Wheel(const WheelDefinition &definition, Random random, QWidget *parent = nullptr);
+
+    // Spins to a segment decided by the game, landedSegment reports it when the wheel stops
+    void spinTo(int segment);
+    bool isSpinning() const { return spinning; }
     void stopSpin();
     int calculateSegment(double angle) const;
 
+    void setSpinSpeed(SpinSpeed speed, int turboMillis = 600);
+    SpinSpeed spinSpeed() const { return speed; }
+
+    // Speed of every wheel created afterwards
+    static void setDefaultSpinSpeed(SpinSpeed speed, int turboMillis);
+
 signals:
     void landedSegment(int index);
 
+protected:
+    void resizeEvent(QResizeEvent *event) override;
+    bool eventFilter(QObject *watched, QEvent *event) override;
+
 private slots:
     void handleAnimationEnd();
 
 private:
     // Graphics components
     QGraphicsScene *scene = nullptr;
-    QGraphicsView *view = nullptr;
+    WheelView *view = nullptr;
     WheelItem *wheelItem = nullptr;
     QGraphicsPixmapItem *arrowItem = nullptr;
 
+    // Full resolution images, scaled down once per widget size rather than on every frame
+    QPixmap wheelSource;
+    QPixmap arrowSource;
+    QSize scaledFor;
+
     // Animation
     QPropertyAnimation *animation = nullptr;
+    QShortcut *skipShortcut = nullptr;
 
     // Spin properties
-    int endAngle = 0;
-    int numSegments = 8;
-    double segmentAngle = 360.0 / numSegments;
+    WheelDefinition definition;
+    Random random;
+    double endAngle = 0.0;
+    int targetSegment = -1;  // decided when the spin starts
     double currentRotation = 0.0;
-    bool isSpinning = false;
+    bool spinning = false;
+    SpinSpeed speed;
+    int turboMillis;
+
+    static SpinSpeed defaultSpeed;
+    static int defaultTurboMillis;
 
     // Helper functions
+    void setUpView();
     void setUpWheelItem();
     void setUpArrow();
+    void scaleToView();
+    void finishSpin();
+    void logFrameStats() const;
+    static QPixmap drawWheel(const WheelDefinition &definition);
 };
 
 #endif // WHEEL_H
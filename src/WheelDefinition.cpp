@@ -0,0 +1,183 @@
+// This file defines the wheel slices and decides where a spin lands
+
+#include "WheelDefinition.h"
+
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <cmath>
+#include <cstdlib>
+
+bool WheelSegment::parse(const std::string &label, WheelSegment &segment) {
+    segment = WheelSegment();
+    segment.label = label;
+
+    if (label == "Free Hint" || label == "free hint") {
+        segment.kind = FreeHint;
+        return true;
+    }
+
+    const char *text = label.c_str();
+    char *end = nullptr;
+    const long amount = std::strtol(text, &end, 10);
+    if (end == text)
+        return false;
+
+    const std::string unit = end;
+    if (unit == " gem" || unit == " gems") {
+        segment.kind = Gems;
+        segment.value = static_cast<int>(amount);
+        return amount >= 0;
+    }
+    if (unit == " second" || unit == " seconds") {
+        segment.kind = TimePenalty;
+        segment.value = static_cast<int>(-amount);
+        return amount <= 0;
+    }
+    return false;
+}
+
+WheelDefinition::WheelDefinition(std::vector<WheelSegment> segments, QString image)
+    : segmentList(std::move(segments)), imagePath(std::move(image))
+{
+    buildAliasTable();
+}
+
+bool WheelDefinition::load(const QString &path, WheelDefinition &wheel, QString *error) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        if (error)
+            *error = "Cannot open " + path;
+        return false;
+    }
+
+    QJsonParseError parseError;
+    const QJsonDocument document = QJsonDocument::fromJson(file.readAll(), &parseError);
+    if (!document.isObject()) {
+        if (error)
+            *error = path + ": " + parseError.errorString();
+        return false;
+    }
+
+    const QJsonObject root = document.object();
+    std::vector<WheelSegment> segments;
+    for (const QJsonValue &value : root.value("segments").toArray()) {
+        const QJsonObject object = value.toObject();
+        const QString label = object.value("label").toString();
+
+        WheelSegment segment;
+        if (!WheelSegment::parse(label.toStdString(), segment)) {
+            if (error)
+                *error = path + ": unknown segment \"" + label + "\"";
+            return false;
+        }
+
+        segment.weight = object.value("weight").toDouble(1.0);
+        if (!(segment.weight > 0.0)) {
+            if (error)
+                *error = path + ": segment \"" + label + "\" needs a positive weight";
+            return false;
+        }
+        segments.push_back(segment);
+    }
+
+    if (segments.empty()) {
+        if (error)
+            *error = path + ": no segments";
+        return false;
+    }
+
+    wheel = WheelDefinition(std::move(segments), root.value("image").toString());
+    return true;
+}
+
+// Vose's method: columns of average weight are filled by one small and one large slice each
+void WheelDefinition::buildAliasTable() {
+    const std::size_t count = segmentList.size();
+    threshold.assign(count, 0);
+    alias.assign(count, 0);
+    totalWeight = 0.0;
+    for (const WheelSegment &segment : segmentList)
+        totalWeight += segment.weight;
+    if (count == 0 || totalWeight <= 0.0)
+        return;
+
+    std::vector<double> scaled(count);
+    std::vector<std::uint32_t> small;
+    std::vector<std::uint32_t> large;
+    for (std::size_t i = 0; i < count; i++) {
+        scaled[i] = segmentList[i].weight * double(count) / totalWeight;
+        (scaled[i] < 1.0 ? small : large).push_back(static_cast<std::uint32_t>(i));
+    }
+
+    const double full = 4294967296.0;  // 2^32
+    while (!small.empty() && !large.empty()) {
+        const std::uint32_t less = small.back();
+        small.pop_back();
+        const std::uint32_t more = large.back();
+
+        threshold[less] = static_cast<std::uint32_t>(scaled[less] * full);
+        alias[less] = more;
+
+        scaled[more] -= 1.0 - scaled[less];
+        if (scaled[more] < 1.0) {
+            large.pop_back();
+            small.push_back(more);
+        }
+    }
+
+    // Whatever is left is full up to rounding
+    for (std::uint32_t i : large) {
+        threshold[i] = 0xFFFFFFFFu;
+        alias[i] = i;
+    }
+    for (std::uint32_t i : small) {
+        threshold[i] = 0xFFFFFFFFu;
+        alias[i] = i;
+    }
+}
+
+double WheelDefinition::probability(int index) const {
+    if (index < 0 || index >= size() || totalWeight <= 0.0)
+        return 0.0;
+    return segmentList[static_cast<std::size_t>(index)].weight / totalWeight;
+}
+
+// The high 32 bits pick a column, the low 32 bits decide between it and its alias
+int WheelDefinition::sample(std::uint64_t random) const {
+    if (segmentList.empty())
+        return -1;
+
+    const std::uint64_t column = ((random >> 32) * segmentList.size()) >> 32;
+    const std::uint32_t coin = static_cast<std::uint32_t>(random);
+    return static_cast<int>(coin < threshold[column] ? column : alias[column]);
+}
+
+int WheelDefinition::segmentAt(double angle) const {
+    if (segmentList.empty())
+        return -1;
+
+    const double slice = sliceAngle();
+    double adjusted = std::fmod(angle + slice / 2.0, 360.0);
+    if (adjusted < 0.0)
+        adjusted += 360.0;
+
+    int index = static_cast<int>(adjusted / slice);
+    if (index >= size())
+        index = size() - 1;
+    return size() - 1 - index;
+}
+
+double WheelDefinition::landingAngle(int index, double position) const {
+    const double slice = sliceAngle();
+    const double margin = 0.1;  // stay clear of the slice borders
+    const double inside = margin + (1.0 - 2.0 * margin) * position;
+
+    double angle = (size() - 1 - index + inside) * slice - slice / 2.0;
+    angle = std::fmod(angle, 360.0);
+    if (angle < 0.0)
+        angle += 360.0;
+    return angle;
+}
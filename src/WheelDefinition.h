@@ -0,0 +1,75 @@
+#ifndef WHEELDEFINITION_H
+#define WHEELDEFINITION_H
+
+#include <QString>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// One slice of the wheel and what it pays out
+struct WheelSegment {
+    enum Kind { Gems, TimePenalty, FreeHint };
+
+    std::string label;  // as shown to the player, e.g. "2 gems" or "-5 seconds"
+    Kind kind = Gems;
+    int value = 0;      // gems won, or seconds lost on a wrong guess
+    double weight = 1.0;  // relative chance of landing on the slice
+
+    // Parses a label such as "3 gems", "1 gem", "-10 seconds" or "Free Hint", returns false
+    // if the label is not one of those forms
+    static bool parse(const std::string &label, WheelSegment &segment);
+};
+
+// The slices of the wheel, shared by the game logic, the wheel widget and the simulator.
+// Every slice covers the same angle but may have its own weight. A spin is decided by
+// sampling a slice from an alias table (constant time for any number of slices), and the
+// widget animates to an angle inside that slice, so what is shown is always what was hit.
+//
+// At rotation 0 the arrow points at the middle of the last slice, the first slice follows
+// clockwise; rotating the wheel clockwise moves the arrow towards lower slice numbers.
+class WheelDefinition {
+public:
+    WheelDefinition() = default;
+    explicit WheelDefinition(std::vector<WheelSegment> segments, QString image = QString());
+
+    // Loads a JSON definition:
+    //   { "image": ":/images/images/pink.png",   (optional, the slices are drawn otherwise)
+    //     "segments": [ { "label": "2 gems", "weight": 2 }, { "label": "Free Hint" }, ... ] }
+    static bool load(const QString &path, WheelDefinition &wheel, QString *error = nullptr);
+
+    bool isEmpty() const { return segmentList.empty(); }
+    int size() const { return static_cast<int>(segmentList.size()); }
+    const WheelSegment &segment(int index) const { return segmentList[static_cast<std::size_t>(index)]; }
+    const std::vector<WheelSegment> &segments() const { return segmentList; }
+
+    // Pre-drawn wheel image, empty when the widget draws the slices itself
+    const QString &image() const { return imagePath; }
+
+    double sliceAngle() const { return 360.0 / size(); }
+    double probability(int index) const;
+
+    // Slice for 64 random bits, distributed by the slice weights
+    int sample(std::uint64_t random) const;
+
+    // Slice under the arrow at a wheel rotation in degrees
+    int segmentAt(double angle) const;
+
+    // Rotation in [0, 360) that puts the arrow on a slice; position in [0, 1) moves across
+    // the slice and is kept away from its edges
+    double landingAngle(int index, double position) const;
+
+private:
+    void buildAliasTable();
+
+    std::vector<WheelSegment> segmentList;
+    QString imagePath;
+    double totalWeight = 0.0;
+
+    // Vose alias table: column i keeps itself when the low 32 bits are below threshold[i],
+    // and gives way to alias[i] otherwise
+    std::vector<std::uint32_t> threshold;
+    std::vector<std::uint32_t> alias;
+};
+
+#endif // WHEELDEFINITION_H
@@ -1,6 +1,11 @@
+#include "AssetManager.h"
 #include "MainController.h"
+#include "PhraseLibrary.h"
+#include "PhraseLibraryWatcher.h"
+#include "Wheel.h"
 
 #include <QApplication>
+#include <QCommandLineParser>
 #include <QMainWindow>
 #include <QMessageBox>
 
@@ -8,6 +13,30 @@ int main(int argc, char *argv[]) {
     // Initialize the Qt application
     QApplication app(argc, argv);
 
+    // Wheel speed: experienced players and UI soak tests do not want to wait for the spin
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    const QCommandLineOption spinOption("spin", "Wheel spin speed: normal, turbo or instant.", "speed", "normal");
+    const QCommandLineOption turboOption("turbo-ms", "Length of a turbo spin in milliseconds.", "ms", "600");
+    parser.addOption(spinOption);
+    parser.addOption(turboOption);
+    parser.process(app);
+
+    const QString spin = parser.value(spinOption);
+    const Wheel::SpinSpeed speed = spin == "instant" ? Wheel::InstantSpin
+                                 : spin == "turbo"   ? Wheel::TurboSpin
+                                                     : Wheel::NormalSpin;
+    Wheel::setDefaultSpinSpeed(speed, parser.value(turboOption).toInt());
+
+    // Decode the images on worker threads while the rest of the startup runs
+    AssetManager::preload(app.devicePixelRatio());
+
+    // The phrases too, a scored pack is also scored and indexed there
+    PhraseLibrary::preload();
+
+    // Pick up phrase pack updates while the game is running
+    PhraseLibraryWatcher phraseWatcher;
+
     // Create the main game window
     MainController window;
     window.setWindowTitle("Spin & Solve");
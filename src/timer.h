@@ -1,10 +0,0 @@
-#ifndef TIMER_H
-#define TIMER_H
-
-class Timer
-{
-public:
-    Timer();
-};
-
-#endif // TIMER_H
@@ -0,0 +1,203 @@
+// Offline compiler that turns a phrase source file into a memory-mappable phrase pack
+//
+// Usage: phrasepack <phrases.txt> <phrases.pack>
+//
+// Each source line is "difficulty|TEXT|Category|hint 1|hint 2|hint 3" where difficulty is
+// "easy", "hard" or "auto" and up to three hints may be given. A source using "auto" for
+// every phrase gets its easy/hard levels from the automatic difficulty scores at load time.
+// Blank lines and lines starting with '#' are ignored.
+
+#include "PhrasePackFormat.h"
+#include "StringArena.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace PhrasePackFormat;
+
+struct SourcePhrase {
+    std::uint8_t difficulty;  // 0 = easy, 1 = hard, 2 = auto
+    std::vector<std::string> fields; // text, category, hints...
+};
+
+// Splits a source line on '|'
+static std::vector<std::string> splitFields(const std::string &line) {
+    std::vector<std::string> fields;
+    std::string::size_type start = 0;
+    while (true) {
+        std::string::size_type end = line.find('|', start);
+        fields.push_back(line.substr(start, end - start));
+        if (end == std::string::npos)
+            break;
+        start = end + 1;
+    }
+    return fields;
+}
+
+// Adds a string to the blob, once per distinct string, and returns its reference
+static PackString appendString(StringArena &blob, const std::string &text) {
+    const StringArena::Ref &ref = blob.ref(blob.intern(text));
+    return PackString{ ref.offset, ref.length };
+}
+
+static bool readSource(const char *path, std::vector<SourcePhrase> &phrases) {
+    std::ifstream in(path);
+    if (!in) {
+        std::cerr << "Cannot open " << path << "\n";
+        return false;
+    }
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(in, line)) {
+        lineNumber++;
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        std::vector<std::string> fields = splitFields(line);
+        if (fields.size() < 3 || fields.size() > 3 + static_cast<std::size_t>(maxHints)) {
+            std::cerr << path << ":" << lineNumber << ": expected difficulty|TEXT|Category|hints...\n";
+            return false;
+        }
+
+        SourcePhrase phrase;
+        if (fields[0] == "easy")
+            phrase.difficulty = 0;
+        else if (fields[0] == "hard")
+            phrase.difficulty = 1;
+        else if (fields[0] == "auto")
+            phrase.difficulty = 2;
+        else {
+            std::cerr << path << ":" << lineNumber << ": unknown difficulty \"" << fields[0] << "\"\n";
+            return false;
+        }
+
+        if (fields[1].empty()) {
+            std::cerr << path << ":" << lineNumber << ": empty phrase text\n";
+            return false;
+        }
+
+        phrase.fields.assign(fields.begin() + 1, fields.end());
+        phrases.push_back(std::move(phrase));
+    }
+    return true;
+}
+
+static bool writePack(const char *path, const std::vector<SourcePhrase> &phrases) {
+    std::size_t autoCount = 0;
+    for (const SourcePhrase &phrase : phrases) {
+        if (phrase.difficulty == 2)
+            autoCount++;
+    }
+    if (autoCount != 0 && autoCount != phrases.size()) {
+        std::cerr << "Either every phrase or none may use the \"auto\" difficulty\n";
+        return false;
+    }
+    const bool scored = autoCount != 0;
+
+    std::vector<PackRecord> records;
+    records.reserve(phrases.size());
+    StringArena blob;
+    StringArena categories;
+
+    // Easy records go first so the reader can split difficulties without an index
+    std::uint32_t easyCount = 0;
+    for (std::uint8_t difficulty = 0; difficulty <= 1; difficulty++) {
+        for (const SourcePhrase &phrase : phrases) {
+            // Scored packs store every phrase in the easy range, the reader splits them by score
+            if ((scored ? 0 : phrase.difficulty) != difficulty)
+                continue;
+
+            PackRecord record;
+            std::memset(&record, 0, sizeof(record));
+            record.difficulty = difficulty;
+            record.text = appendString(blob, phrase.fields[0]);
+            record.category = static_cast<std::uint16_t>(categories.intern(phrase.fields[1]));
+            record.hintCount = static_cast<std::uint8_t>(phrase.fields.size() - 2);
+            for (int i = 0; i < record.hintCount; i++)
+                record.hints[i] = appendString(blob, phrase.fields[2 + i]);
+
+            records.push_back(record);
+            if (difficulty == 0)
+                easyCount++;
+        }
+    }
+
+    if (categories.size() > 0xFFFF) {
+        std::cerr << "Too many categories (at most 65535)\n";
+        return false;
+    }
+
+    std::vector<PackString> categoryTable;
+    for (std::uint32_t id = 0; id < categories.size(); id++)
+        categoryTable.push_back(appendString(blob, std::string(categories.get(id))));
+
+    PackHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.version = version;
+    header.phraseCount = static_cast<std::uint32_t>(records.size());
+    header.easyCount = easyCount;
+    header.categoriesOffset = sizeof(PackHeader);
+    header.categoryCount = static_cast<std::uint32_t>(categoryTable.size());
+    header.recordsOffset = static_cast<std::uint32_t>(header.categoriesOffset + categoryTable.size() * sizeof(PackString));
+    header.blobOffset = static_cast<std::uint32_t>(header.recordsOffset + records.size() * sizeof(PackRecord));
+    header.blobSize = static_cast<std::uint32_t>(blob.buffer().size());
+    header.flags = scored ? scoredDifficultyFlag : 0;
+
+    // The pack is written next to the target and renamed over it, a running game may still
+    // have the old pack mapped and must never see it truncated or half written
+    const std::string temporaryPath = std::string(path) + ".tmp";
+    std::ofstream out(temporaryPath, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        std::cerr << "Cannot write " << temporaryPath << "\n";
+        return false;
+    }
+
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(categoryTable.data()), categoryTable.size() * sizeof(PackString));
+    out.write(reinterpret_cast<const char *>(records.data()), records.size() * sizeof(PackRecord));
+    out.write(blob.buffer().data(), blob.buffer().size());
+    out.close();
+    if (!out) {
+        std::cerr << "Cannot write " << temporaryPath << "\n";
+        std::remove(temporaryPath.c_str());
+        return false;
+    }
+
+    if (std::rename(temporaryPath.c_str(), path) != 0) {
+#ifdef _WIN32
+        // Windows does not rename over an existing file
+        std::remove(path);
+        if (std::rename(temporaryPath.c_str(), path) == 0)
+            return true;
+#endif
+        std::cerr << "Cannot replace " << path << "\n";
+        std::remove(temporaryPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        std::cerr << "Usage: phrasepack <phrases.txt> <phrases.pack>\n";
+        return 1;
+    }
+
+    std::vector<SourcePhrase> phrases;
+    if (!readSource(argv[1], phrases))
+        return 1;
+
+    if (!writePack(argv[2], phrases))
+        return 1;
+
+    std::cout << "Wrote " << phrases.size() << " phrases to " << argv[2] << "\n";
+    return 0;
+}
@@ -0,0 +1,17 @@
+# Phrase pack compiler (command line, no Qt required)
+
+CONFIG   += c++17 console
+CONFIG   -= app_bundle qt
+
+TEMPLATE = app
+TARGET   = phrasepack
+
+INCLUDEPATH += ../../src
+
+SOURCES += \
+    main.cpp \
+    ../../src/StringArena.cpp
+
+HEADERS += \
+    ../../src/PhrasePackFormat.h \
+    ../../src/StringArena.h
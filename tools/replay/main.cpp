@@ -0,0 +1,111 @@
+// Headless replay of recorded Spin & Solve sessions
+//
+// Usage: replay [options] FILE...
+//   --repeat N   replay every log N times, for timing (default 1)
+//   --verbose    print the outcome of every round
+//
+// Each log is re-driven through GameSession as fast as it decodes, with no UI and no timers,
+// and every recorded result and spin is checked. Exits with 1 if any log fails to read or
+// replays differently from how it was played.
+
+#include "SessionLog.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+static const char *phaseName(GameSession::Phase phase) {
+    switch (phase) {
+    case GameSession::Phase::Spin:
+        return "waiting for a spin";
+    case GameSession::Phase::Consonant:
+        return "waiting for a consonant";
+    case GameSession::Phase::Won:
+        return "won";
+    case GameSession::Phase::Lost:
+        return "lost";
+    }
+    return "";
+}
+
+int main(int argc, char *argv[]) {
+    unsigned long long repeat = 1;
+    bool verbose = false;
+    std::vector<std::string> paths;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string option = argv[i];
+        if (option == "--repeat") {
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for " << option << "\n";
+                return 1;
+            }
+            repeat = std::max(1ULL, std::strtoull(argv[++i], nullptr, 10));
+        } else if (option == "--verbose") {
+            verbose = true;
+        } else if (option.compare(0, 2, "--") == 0) {
+            std::cerr << "Unknown option " << option << "\n";
+            return 1;
+        } else {
+            paths.push_back(option);
+        }
+    }
+    if (paths.empty()) {
+        std::cerr << "Usage: replay [--repeat N] [--verbose] FILE...\n";
+        return 1;
+    }
+
+    bool failed = false;
+    std::uint64_t totalRecords = 0;
+    double totalSeconds = 0.0;
+
+    for (const std::string &path : paths) {
+        std::vector<std::uint8_t> data;
+        if (!SessionReplay::readFile(path, data)) {
+            std::cerr << "Cannot read " << path << "\n";
+            failed = true;
+            continue;
+        }
+
+        // Only the first pass reports rounds, the others are for timing
+        int round = 0;
+        const SessionReplay::RoundCallback printRound = [&round](const GameSession &session) {
+            std::printf("  round %d: %s, %d gems, %.1f s left, %d hints, \"%s\"\n", ++round,
+                        phaseName(session.phase()), session.gems(), session.remainingMillis() / 1000.0,
+                        session.hintsUsed(), session.board().text().c_str());
+        };
+
+        std::printf("%s\n", path.c_str());
+        ReplayReport report;
+        const auto start = std::chrono::steady_clock::now();
+        for (unsigned long long pass = 0; pass < repeat; pass++)
+            report = SessionReplay::replay(data.data(), data.size(),
+                                           verbose && pass == 0 ? printRound : SessionReplay::RoundCallback());
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::printf("  seed %016llx: %llu records, %llu rounds, %llu won, %llu mismatches\n",
+                    static_cast<unsigned long long>(report.seed), static_cast<unsigned long long>(report.records),
+                    static_cast<unsigned long long>(report.rounds), static_cast<unsigned long long>(report.wins),
+                    static_cast<unsigned long long>(report.mismatches));
+        std::printf("  ends %s with %d gems and %.1f s left\n", phaseName(report.phase), report.gems,
+                    report.remainingMillis / 1000.0);
+        if (!report.error.empty()) {
+            std::printf("  error: %s\n", report.error.c_str());
+            failed = true;
+        }
+        if (report.mismatches)
+            failed = true;
+
+        totalRecords += report.records * repeat;
+        totalSeconds += seconds;
+    }
+
+    if (totalSeconds > 0.0)
+        std::printf("\n%llu records replayed in %.3f s (%.0f records/s)\n",
+                    static_cast<unsigned long long>(totalRecords), totalSeconds, totalRecords / totalSeconds);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,27 @@
+# Headless replay of recorded game sessions (Qt Core only, no widgets)
+
+QT       = core
+CONFIG  += c++17 console
+CONFIG  -= app_bundle
+
+TEMPLATE = app
+TARGET   = replay
+
+INCLUDEPATH += ../../src
+
+SOURCES += \
+    main.cpp \
+    ../../src/GameRules.cpp \
+    ../../src/GameSession.cpp \
+    ../../src/PhraseBoard.cpp \
+    ../../src/Random.cpp \
+    ../../src/SessionLog.cpp \
+    ../../src/WheelDefinition.cpp
+
+HEADERS += \
+    ../../src/GameRules.h \
+    ../../src/GameSession.h \
+    ../../src/PhraseBoard.h \
+    ../../src/Random.h \
+    ../../src/SessionLog.h \
+    ../../src/WheelDefinition.h
@@ -0,0 +1,128 @@
+// This file implements the player strategies used by the simulator
+
+#include "Bots.h"
+#include "LetterRecommender.h"
+
+static const char vowels[] = "AEIOU";
+static const char consonantsByFrequency[] = "TNSHRDLCMWFGYPBVKJXQZ";
+
+static bool isVowel(char letter) {
+    return LetterRecommender::isVowel(letter);
+}
+
+// First unguessed letter of a preference list
+static char firstUnguessed(const PhraseBoard &board, const char *letters) {
+    for (const char *c = letters; *c; c++) {
+        if (!board.isGuessed(*c))
+            return *c;
+    }
+    return 0;
+}
+
+static char randomUnguessed(const PhraseBoard &board, bool vowel, Random &rng) {
+    char choices[26];
+    int count = 0;
+    for (char c = 'A'; c <= 'Z'; c++) {
+        if (isVowel(c) == vowel && !board.isGuessed(c))
+            choices[count++] = c;
+    }
+    if (count == 0)
+        return 0;
+    return choices[rng.bounded(static_cast<std::uint32_t>(count))];
+}
+
+// Guesses letters at random, buys a vowel half of the time it can, never buys hints and
+// only solves once a single phrase fits the board
+class RandomBot : public Bot {
+public:
+    std::string name() const override { return "random"; }
+
+    BotMove nextMove(const BotView &view, Random &rng) const override {
+        if (view.candidates <= 1 && view.solveChance > 0.0)
+            return BotMove::Solve;
+        if (view.gems >= view.rules.vowelCost && firstUnguessed(view.board, vowels)
+            && rng.chance(0.5))
+            return BotMove::BuyVowel;
+        return BotMove::Spin;
+    }
+
+    char consonant(const BotView &view, Random &rng) const override {
+        return randomUnguessed(view.board, false, rng);
+    }
+
+    char vowel(const BotView &view, Random &rng) const override {
+        return randomUnguessed(view.board, true, rng);
+    }
+};
+
+// Guesses letters in English frequency order, buys vowels whenever it can, spends free
+// hints right away and solves as soon as it is more likely right than wrong
+class FrequencyBot : public Bot {
+public:
+    std::string name() const override { return "frequency"; }
+
+    BotMove nextMove(const BotView &view, Random &) const override {
+        if (view.solveChance >= 0.5)
+            return BotMove::Solve;
+        if (view.freeHints > 0 && view.hintsLeft > 0)
+            return BotMove::BuyHint;
+        if (view.gems >= view.rules.vowelCost && firstUnguessed(view.board, vowels))
+            return BotMove::BuyVowel;
+        return BotMove::Spin;
+    }
+
+    char consonant(const BotView &view, Random &) const override {
+        return firstUnguessed(view.board, consonantsByFrequency);
+    }
+
+    char vowel(const BotView &view, Random &) const override {
+        return firstUnguessed(view.board, "EAOIU");
+    }
+};
+
+// Picks letters by expected information gain, buys a vowel when the best vowel beats the
+// best consonant, and buys hints when many phrases still fit and gems are plentiful
+class SmartBot : public Bot {
+public:
+    std::string name() const override { return "smart"; }
+
+    BotMove nextMove(const BotView &view, Random &) const override {
+        if (view.solveChance >= 0.5)
+            return BotMove::Solve;
+        if (view.hintsLeft > 0 && view.candidates > 4
+            && (view.freeHints > 0 || view.gems >= view.rules.hintCost + view.rules.vowelCost))
+            return BotMove::BuyHint;
+
+        if (view.gems >= view.rules.vowelCost) {
+            const LetterAdvice advice = LetterRecommender::recommend(view.library, view.board, view.categoryId, 1);
+            if (!advice.vowels.empty() && advice.vowels.front().probability > 0.0
+                && (advice.consonants.empty() || advice.vowels.front().information >= advice.consonants.front().information))
+                return BotMove::BuyVowel;
+        }
+        return BotMove::Spin;
+    }
+
+    char consonant(const BotView &view, Random &) const override {
+        const LetterAdvice advice = LetterRecommender::recommend(view.library, view.board, view.categoryId, 1);
+        return advice.consonants.empty() ? 0 : advice.consonants.front().letter;
+    }
+
+    char vowel(const BotView &view, Random &) const override {
+        const LetterAdvice advice = LetterRecommender::recommend(view.library, view.board, view.categoryId, 1);
+        return advice.vowels.empty() ? 0 : advice.vowels.front().letter;
+    }
+};
+
+std::unique_ptr<Bot> createBot(const std::string &name) {
+    if (name == "random")
+        return std::make_unique<RandomBot>();
+    if (name == "frequency")
+        return std::make_unique<FrequencyBot>();
+    if (name == "smart")
+        return std::make_unique<SmartBot>();
+    return nullptr;
+}
+
+std::vector<std::string> botNames() {
+    return { "random", "frequency", "smart" };
+}
@@ -0,0 +1,50 @@
+#ifndef BOTS_H
+#define BOTS_H
+
+#include "GameRules.h"
+#include "PhraseBoard.h"
+#include "Random.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+class PhraseLibrary;
+
+// What a bot can see of the game it is playing
+struct BotView {
+    const GameRules &rules;
+    const PhraseLibrary &library;
+    const PhraseBoard &board;
+    int categoryId = -1;
+    int gems = 0;
+    int freeHints = 0;
+    int hintsUsed = 0;
+    int hintsLeft = 0;           // hints the phrase still has, within rules.maxHints
+    double remainingSeconds = 0.0;
+    std::size_t candidates = 0;  // corpus phrases still consistent with the board
+    double solveChance = 0.0;    // chance a solve attempt would be right
+};
+
+enum class BotMove { Spin, BuyVowel, BuyHint, Solve };
+
+// A player strategy. Bots are shared by every simulation thread, so they keep no state of
+// their own; any randomness comes from the generator of the game being played.
+class Bot {
+public:
+    virtual ~Bot() = default;
+
+    virtual std::string name() const = 0;
+    virtual BotMove nextMove(const BotView &view, Random &rng) const = 0;
+
+    // Letter to guess, 0 if the bot has none left of that kind
+    virtual char consonant(const BotView &view, Random &rng) const = 0;
+    virtual char vowel(const BotView &view, Random &rng) const = 0;
+};
+
+// Bot registered under a name ("random", "frequency" or "smart"), null for an unknown name
+std::unique_ptr<Bot> createBot(const std::string &name);
+std::vector<std::string> botNames();
+
+#endif // BOTS_H
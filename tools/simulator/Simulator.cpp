@@ -0,0 +1,184 @@
+// This file plays simulated games of Spin & Solve to measure the game economy
+
+#include "Simulator.h"
+#include "GameSession.h"
+#include "Parallel.h"
+#include "PhraseLibrary.h"
+
+#include <algorithm>
+#include <mutex>
+
+void SimulationReport::merge(const SimulationReport &other) {
+    games += other.games;
+    wins += other.wins;
+    solvedByGuess += other.solvedByGuess;
+    wrongSolves += other.wrongSolves;
+    spins += other.spins;
+    vowelsBought += other.vowelsBought;
+    hintsUsed += other.hintsUsed;
+    freeHintsWon += other.freeHintsWon;
+    for (int i = 0; i < gemBuckets; i++)
+        finalGems[i] += other.finalGems[i];
+    if (timeLeftOnWin.size() < other.timeLeftOnWin.size())
+        timeLeftOnWin.resize(other.timeLeftOnWin.size(), 0);
+    for (std::size_t i = 0; i < other.timeLeftOnWin.size(); i++)
+        timeLeftOnWin[i] += other.timeLeftOnWin[i];
+}
+
+double PlayerModel::solveChance(double revealed, int hints) const {
+    const double known = revealed + hints * hintReveal;
+    if (known <= recogniseFrom)
+        return 0.0;
+    if (known >= recogniseAt)
+        return 1.0;
+    return (known - recogniseFrom) / (recogniseAt - recogniseFrom);
+}
+
+Simulator::Simulator(const PhraseLibrary &library, const SimulationSettings &settings)
+    : library(library), settings(settings)
+{
+    for (int difficulty = 0; difficulty < 2; difficulty++) {
+        PhraseQuery query;
+        query.difficulty = difficulty;
+        pools[difficulty] = library.index().match(query);
+    }
+}
+
+SimulationReport Simulator::run(const Bot &bot, int difficulty) const {
+    SimulationReport total;
+    std::mutex mergeLock;
+
+    parallelFor(static_cast<std::size_t>(settings.games), [&](std::size_t begin, std::size_t end) {
+        SimulationReport local;
+        for (std::size_t game = begin; game < end; game++)
+            playGame(bot, difficulty, game, local);
+
+        std::lock_guard<std::mutex> lock(mergeLock);
+        total.merge(local);
+    }, settings.threads);
+
+    return total;
+}
+
+void Simulator::playGame(const Bot &bot, int difficulty, std::uint64_t game, SimulationReport &report) const {
+    const std::vector<std::uint32_t> &pool = pools[difficulty];
+    const GameRules &rules = settings.rules;
+    const PlayerModel &player = settings.player;
+    if (pool.empty() || rules.wheel.isEmpty())
+        return;
+
+    Random rng = Random::stream(settings.seed, game * 2 + static_cast<std::uint64_t>(difficulty));
+
+    const PhraseView phrase = library.phrase(static_cast<int>(pool[rng.bounded(static_cast<std::uint32_t>(pool.size()))]));
+    const PhraseSolver &solver = library.solver();
+
+    GameSession::Phrase dealt;
+    dealt.text = std::string(phrase.text);
+    dealt.id = phrase.id;
+    dealt.categoryId = phrase.categoryId;
+    for (int i = 0; i < phrase.hintCount; i++)
+        dealt.hints.emplace_back(phrase.hints[i]);
+
+    // The session plays the wheel from its own generator, the bot keeps the game's
+    GameSession session(rules, rng.next());
+    std::int64_t freeHints = 0;
+    bool completedByLetter = false;
+    session.setListener([&](const GameSession::Event &event) {
+        if (event.type == GameSession::Event::FreeHintsChanged) {
+            if (event.value > freeHints)
+                report.freeHintsWon++;
+            freeHints = event.value;
+        } else if (event.type == GameSession::Event::Won) {
+            completedByLetter = event.value != 0;
+        }
+    });
+    session.start(difficulty, std::move(dealt));
+
+    const PhraseBoard &board = session.board();
+    const double letterCount = std::max(board.hiddenCount(), 1);
+    report.games++;
+
+    auto seconds = [](double value) { return static_cast<std::int64_t>(value * 1000.0 + 0.5); };
+
+    // Every move either reveals a letter or costs time, so a game always ends; the move cap
+    // only guards against a bot that keeps choosing moves it cannot make
+    for (int move = 0; move < 500 && !session.isOver(); move++) {
+        BotView view{ rules, library, board };
+        view.categoryId = phrase.categoryId;
+        view.gems = session.gems();
+        view.freeHints = session.freeHints();
+        view.hintsUsed = session.hintsUsed();
+        view.hintsLeft = session.hintsLeft();
+        view.remainingSeconds = session.remainingMillis() / 1000.0;
+
+        std::string pattern(static_cast<std::size_t>(board.length()), ' ');
+        for (int i = 0; i < board.length(); i++)
+            pattern[i] = board.cell(i);
+        view.candidates = solver.count(pattern, board.guessedMask(), phrase.categoryId);
+        view.solveChance = player.solveChance(1.0 - double(board.hiddenCount()) / letterCount, session.hintsUsed());
+
+        BotMove choice = bot.nextMove(view, rng);
+        if (choice == BotMove::BuyVowel && !session.canBuyVowel())
+            choice = BotMove::Spin;
+        if (choice == BotMove::BuyHint && !session.canBuyHint())
+            choice = BotMove::Spin;
+
+        switch (choice) {
+        case BotMove::Spin: {
+            const char letter = bot.consonant(view, rng);
+            if (!letter) {
+                // Nothing left to spin for, the bot has to solve
+                choice = BotMove::Solve;
+                break;
+            }
+
+            report.spins++;
+            session.tick(seconds(player.spinSeconds + player.letterSeconds));
+            if (session.spin() == GameSession::Result::Ok)
+                session.guessConsonant(letter);
+            break;
+        }
+        case BotMove::BuyVowel: {
+            const char letter = bot.vowel(view, rng);
+            if (!letter)
+                break;
+
+            session.tick(seconds(player.letterSeconds));
+            if (session.buyVowel(letter) == GameSession::Result::Ok)
+                report.vowelsBought++;
+            break;
+        }
+        case BotMove::BuyHint:
+            session.tick(seconds(player.hintSeconds));
+            if (session.buyHint() == GameSession::Result::Ok)
+                report.hintsUsed++;
+            break;
+        case BotMove::Solve:
+            break;
+        }
+
+        if (choice == BotMove::Solve) {
+            session.tick(seconds(player.solveSeconds));
+            if (session.isOver())
+                break;
+
+            // A player who does not recognise the phrase guesses something else
+            const bool recognised = rng.chance(view.solveChance);
+            session.solve(recognised ? std::string_view(board.text()) : std::string_view());
+            if (!recognised)
+                report.wrongSolves++;
+        }
+    }
+
+    const int gems = session.gems();
+    report.finalGems[std::min(std::max(gems, 0), SimulationReport::gemBuckets - 1)]++;
+    if (session.phase() == GameSession::Phase::Won) {
+        report.wins++;
+        if (completedByLetter)
+            report.solvedByGuess++;
+        const std::size_t bucket = static_cast<std::size_t>(session.remainingMillis() / 1000) / SimulationReport::timeBucketSeconds;
+        if (report.timeLeftOnWin.size() <= bucket)
+            report.timeLeftOnWin.resize(bucket + 1, 0);
+        report.timeLeftOnWin[bucket]++;
+    }
+}
@@ -0,0 +1,70 @@
+#ifndef SIMULATOR_H
+#define SIMULATOR_H
+
+#include "Bots.h"
+#include "GameRules.h"
+
+#include <cstdint>
+#include <vector>
+
+class PhraseLibrary;
+
+// How a simulated player performs, on top of the game rules. The chance of recognising the
+// phrase grows with the share of letters revealed: none below recogniseFrom, certain from
+// recogniseAt on, and every hint read counts as hintReveal more of the phrase revealed.
+struct PlayerModel {
+    double spinSeconds = 4.0;   // the wheel animation
+    double letterSeconds = 2.0; // choosing and typing a letter
+    double hintSeconds = 3.0;   // reading a hint
+    double solveSeconds = 8.0;  // typing the full phrase
+    double recogniseFrom = 0.4;
+    double recogniseAt = 0.9;
+    double hintReveal = 0.15;
+
+    double solveChance(double revealed, int hints) const;
+};
+
+struct SimulationSettings {
+    GameRules rules = GameRules::standard();
+    PlayerModel player;
+    std::uint64_t games = 100000;  // per difficulty
+    std::uint64_t seed = 1;
+    unsigned threads = 0;          // 0 = one per core
+};
+
+// Outcome of all games one bot played at one difficulty
+struct SimulationReport {
+    static const int gemBuckets = 31;      // final gems 0..29, and 30 or more
+    static const int timeBucketSeconds = 10;
+
+    std::uint64_t games = 0;
+    std::uint64_t wins = 0;
+    std::uint64_t solvedByGuess = 0;   // wins where the last letter completed the board
+    std::uint64_t wrongSolves = 0;
+    std::uint64_t spins = 0;
+    std::uint64_t vowelsBought = 0;
+    std::uint64_t hintsUsed = 0;
+    std::uint64_t freeHintsWon = 0;
+    std::vector<std::uint64_t> finalGems = std::vector<std::uint64_t>(gemBuckets, 0);
+    std::vector<std::uint64_t> timeLeftOnWin;  // by timeBucketSeconds buckets
+
+    void merge(const SimulationReport &other);
+};
+
+// Plays complete games headlessly. Every game draws from its own stream of the seed (see
+// Random::stream), so results do not depend on the number of threads.
+class Simulator {
+public:
+    Simulator(const PhraseLibrary &library, const SimulationSettings &settings);
+
+    SimulationReport run(const Bot &bot, int difficulty) const;
+
+private:
+    void playGame(const Bot &bot, int difficulty, std::uint64_t game, SimulationReport &report) const;
+
+    const PhraseLibrary &library;
+    SimulationSettings settings;
+    std::vector<std::uint32_t> pools[2];  // phrase ids by difficulty
+};
+
+#endif // SIMULATOR_H
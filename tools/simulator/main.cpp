@@ -0,0 +1,158 @@
+// Headless Monte Carlo simulator for balancing the Spin & Solve economy
+//
+// Usage: simulator [options]
+//   --games N           games per bot and difficulty (default 100000)
+//   --seed N            base seed, the same seed replays the same games (default 1)
+//   --threads N         worker threads (default: one per core)
+//   --bots a,b          strategies to run: random, frequency, smart (default: all)
+//   --pack PATH         phrase pack or shard directory (default: built-in phrases)
+//   --wheel PATH        wheel definition in JSON, see data/wheel.json
+//   --segments A,B,...  wheel slices of equal weight, e.g. "2 gems,-5 seconds,Free Hint,Free Hint"
+//   --starting-gems N, --vowel-cost N, --hint-cost N, --max-hints N
+//   --easy-seconds N, --hard-seconds N, --solve-penalty N
+
+#include "Bots.h"
+#include "PhraseLibrary.h"
+#include "Simulator.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+static std::vector<std::string> splitList(const std::string &text) {
+    std::vector<std::string> items;
+    std::string::size_type start = 0;
+    while (true) {
+        const std::string::size_type end = text.find(',', start);
+        const std::string item = text.substr(start, end - start);
+        if (!item.empty())
+            items.push_back(item);
+        if (end == std::string::npos)
+            break;
+        start = end + 1;
+    }
+    return items;
+}
+
+static void printReport(const std::string &bot, int difficulty, const SimulationReport &report, double seconds) {
+    const double games = report.games ? double(report.games) : 1.0;
+    std::printf("\n%s, %s: %llu games in %.2f s\n", bot.c_str(), difficulty == 0 ? "easy" : "hard",
+                static_cast<unsigned long long>(report.games), seconds);
+    std::printf("  win rate        %6.2f %%  (%.2f %% completed by a letter)\n",
+                100.0 * report.wins / games, 100.0 * report.solvedByGuess / games);
+    std::printf("  per game        %.2f spins, %.2f vowels, %.2f hints, %.2f free hints won, %.2f wrong solves\n",
+                report.spins / games, report.vowelsBought / games, report.hintsUsed / games,
+                report.freeHintsWon / games, report.wrongSolves / games);
+
+    std::printf("  final gems     ");
+    for (int gems = 0; gems < SimulationReport::gemBuckets; gems++) {
+        if (report.finalGems[gems])
+            std::printf(" %d%s:%.1f%%", gems, gems == SimulationReport::gemBuckets - 1 ? "+" : "",
+                        100.0 * report.finalGems[gems] / games);
+    }
+    std::printf("\n  time left (win)");
+    const double wins = report.wins ? double(report.wins) : 1.0;
+    for (std::size_t bucket = 0; bucket < report.timeLeftOnWin.size(); bucket++) {
+        if (report.timeLeftOnWin[bucket])
+            std::printf(" %zus:%.1f%%", bucket * SimulationReport::timeBucketSeconds,
+                        100.0 * report.timeLeftOnWin[bucket] / wins);
+    }
+    std::printf("\n");
+}
+
+int main(int argc, char *argv[]) {
+    SimulationSettings settings;
+    std::vector<std::string> bots = botNames();
+    std::string packPath;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string option = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << option << "\n";
+            return 1;
+        }
+        const std::string value = argv[++i];
+        const int number = std::atoi(value.c_str());
+
+        if (option == "--games")
+            settings.games = std::strtoull(value.c_str(), nullptr, 10);
+        else if (option == "--seed")
+            settings.seed = std::strtoull(value.c_str(), nullptr, 10);
+        else if (option == "--threads")
+            settings.threads = static_cast<unsigned>(number);
+        else if (option == "--bots")
+            bots = splitList(value);
+        else if (option == "--pack")
+            packPath = value;
+        else if (option == "--starting-gems")
+            settings.rules.startingGems = number;
+        else if (option == "--vowel-cost")
+            settings.rules.vowelCost = number;
+        else if (option == "--hint-cost")
+            settings.rules.hintCost = number;
+        else if (option == "--max-hints")
+            settings.rules.maxHints = number;
+        else if (option == "--easy-seconds")
+            settings.rules.easySeconds = number;
+        else if (option == "--hard-seconds")
+            settings.rules.hardSeconds = number;
+        else if (option == "--solve-penalty")
+            settings.rules.wrongSolvePenaltySeconds = number;
+        else if (option == "--wheel") {
+            QString error;
+            if (!WheelDefinition::load(QString::fromStdString(value), settings.rules.wheel, &error)) {
+                std::cerr << error.toStdString() << "\n";
+                return 1;
+            }
+        } else if (option == "--segments") {
+            std::vector<WheelSegment> segments;
+            for (const std::string &label : splitList(value)) {
+                WheelSegment segment;
+                if (!WheelSegment::parse(label, segment)) {
+                    std::cerr << "Unknown wheel segment \"" << label << "\"\n";
+                    return 1;
+                }
+                segments.push_back(segment);
+            }
+            settings.rules.wheel = WheelDefinition(std::move(segments));
+        } else {
+            std::cerr << "Unknown option " << option << "\n";
+            return 1;
+        }
+    }
+
+    std::unique_ptr<PhraseLibrary> library = packPath.empty()
+        ? std::make_unique<PhraseLibrary>()
+        : std::make_unique<PhraseLibrary>(QString::fromStdString(packPath));
+    if (!packPath.empty() && !library->isLoaded()) {
+        std::cerr << "Cannot load phrases from " << packPath << "\n";
+        return 1;
+    }
+
+    std::printf("%d phrases, wheel:", library->size());
+    for (int i = 0; i < settings.rules.wheel.size(); i++)
+        std::printf(" [%s %.1f%%]", settings.rules.wheel.segment(i).label.c_str(), 100.0 * settings.rules.wheel.probability(i));
+    std::printf("\n");
+
+    const Simulator simulator(*library, settings);
+    for (const std::string &name : bots) {
+        const std::unique_ptr<Bot> bot = createBot(name);
+        if (!bot) {
+            std::cerr << "Unknown bot \"" << name << "\"\n";
+            return 1;
+        }
+
+        for (int difficulty = 0; difficulty < 2; difficulty++) {
+            const auto start = std::chrono::steady_clock::now();
+            const SimulationReport report = simulator.run(*bot, difficulty);
+            const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            printReport(name, difficulty, report, seconds);
+        }
+    }
+    return 0;
+}
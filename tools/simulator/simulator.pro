@@ -0,0 +1,50 @@
+# Headless game simulator for economy balancing (Qt Core only, no widgets)
+
+QT       = core
+CONFIG  += c++17 console thread
+CONFIG  -= app_bundle
+
+TEMPLATE = app
+TARGET   = simulator
+
+INCLUDEPATH += ../../src
+
+SOURCES += \
+    main.cpp \
+    Bots.cpp \
+    Simulator.cpp \
+    ../../src/GameRules.cpp \
+    ../../src/GameSession.cpp \
+    ../../src/LetterRecommender.cpp \
+    ../../src/PhraseBoard.cpp \
+    ../../src/PhraseIndex.cpp \
+    ../../src/PhraseLibrary.cpp \
+    ../../src/PhrasePack.cpp \
+    ../../src/PhraseScorer.cpp \
+    ../../src/PhraseSolver.cpp \
+    ../../src/Random.cpp \
+    ../../src/SessionLog.cpp \
+    ../../src/ShardedPhraseSource.cpp \
+    ../../src/StringArena.cpp \
+    ../../src/WheelDefinition.cpp
+
+HEADERS += \
+    Bots.h \
+    Simulator.h \
+    ../../src/GameRules.h \
+    ../../src/GameSession.h \
+    ../../src/LetterRecommender.h \
+    ../../src/Parallel.h \
+    ../../src/PhraseBoard.h \
+    ../../src/PhraseIndex.h \
+    ../../src/PhraseLibrary.h \
+    ../../src/PhrasePack.h \
+    ../../src/PhrasePackFormat.h \
+    ../../src/PhraseScorer.h \
+    ../../src/PhraseSolver.h \
+    ../../src/Random.h \
+    ../../src/PhraseView.h \
+    ../../src/SessionLog.h \
+    ../../src/ShardedPhraseSource.h \
+    ../../src/StringArena.h \
+    ../../src/WheelDefinition.h